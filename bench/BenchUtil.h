@@ -0,0 +1,72 @@
+#pragma once
+
+//Included files
+#include "Inventory.h"
+
+//Needed libraries
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define WMS_BENCH_RUSAGE 1
+#endif
+
+// Shared helpers for the programs in bench/. Each program builds its own
+// data set, so a run needs nothing but the binary (see README).
+namespace bench {
+    inline double nowMs() {
+        using namespace std::chrono;
+        return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Best of `runs` timings of `work`, in milliseconds
+    template<typename Work>
+    double bestOf(int runs, Work &&work) {
+        double best = 1e300;
+        for (int r = 0; r < runs; ++r) {
+            const double start = nowMs();
+            work();
+            const double took = nowMs() - start;
+            if (took < best) best = took;
+        }
+        return best;
+    }
+
+    // Peak resident set of the process in MB (0 where getrusage is missing)
+    inline long peakRssMB() {
+#ifdef WMS_BENCH_RUSAGE
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+        return static_cast<long>(usage.ru_maxrss / (1024 * 1024));
+#else
+        return static_cast<long>(usage.ru_maxrss / 1024);
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    inline size_t argOr(int argc, char **argv, int index, size_t fallback) {
+        return argc > index ? static_cast<size_t>(std::stoul(argv[index])) : fallback;
+    }
+
+    // Synthetic catalog: 6 zones x 20 aisles x 7 racks x 30 bins, names
+    // sharing most trigrams, every item with a unique SKU
+    inline void fillCatalog(Inventory &inv, size_t count) {
+        inv.reserve(count);
+        for (size_t n = 1; n <= count; ++n) {
+            const int i = static_cast<int>(n);
+            char loc[32];
+            std::snprintf(loc, sizeof loc, "%c-%02d-%02d-%02d", 'A' + i % 6, i % 20 + 1, i % 7 + 1, i % 30 + 1);
+            inv.emplaceItem(i, "Item name number " + std::to_string(i), i % 500, loc, 1.5 * (i % 100),
+                            "EGP", "pcs", "general", "SKU" + std::to_string(i));
+        }
+    }
+
+    inline void row(const std::string &label, double ms, const std::string &note = "") {
+        std::printf("  %-34s %10.3f ms  %s\n", label.c_str(), ms, note.c_str());
+    }
+}
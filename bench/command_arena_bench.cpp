@@ -0,0 +1,120 @@
+//Included files
+#include "BenchUtil.h"
+#include "CommandContext.hpp"
+#include "addComand.hpp"
+#include "parser.hpp"
+
+//Needed libraries
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <streambuf>
+#include <vector>
+
+// Scripted command throughput with and without the per-command arena.
+// Each command line is tokenized (into the arena, when there is one) and
+// executed the way main() runs it, with console output discarded; heap
+// calls are counted by an operator new hook. Runs in a temp directory
+// because `receipt` writes files.
+//   command_arena_bench [runs=2000]
+
+// ─────────────────────────────────────────────
+// Heap call counter
+// ─────────────────────────────────────────────
+static size_t heapCalls = 0;
+
+void* operator new(size_t size) {
+    ++heapCalls;
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align) {
+    ++heapCalls;
+    const size_t a = static_cast<size_t>(align);
+    if (void *p = std::aligned_alloc(a, (size + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+    struct NullBuffer : std::streambuf {
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+    };
+
+    struct Script {
+        const char *line;
+        std::unique_ptr<ICommand> command;
+    };
+}
+
+int main(int argc, char **argv) {
+    const size_t runs = bench::argOr(argc, argv, 1, 2000);
+    const auto dir = std::filesystem::temp_directory_path() / "wms_command_arena_bench";
+    std::filesystem::create_directories(dir);
+    std::filesystem::current_path(dir);
+
+    WmsControllers wms((dir / "inventory_data.json").string());
+    for (int id = 1; id <= 5000; ++id) {
+        char loc[32];
+        std::snprintf(loc, sizeof loc, "%c-%02d-%02d-%02d", 'A' + id % 6, id % 20 + 1, id % 7 + 1, id % 30 + 1);
+        wms.addItem(id, "Item name number " + std::to_string(id), id % 500, loc);
+    }
+    CommandContext ctx{wms, false};
+
+    std::vector<Script> script;
+    script.push_back({"list 3 15", std::make_unique<ListCommand>()});
+    script.push_back({"query in=A qty=0..200 order=-qty limit=14", std::make_unique<QueryCommand>()});
+    script.push_back({"list --after c120 15", std::make_unique<ListCommand>()});
+    script.push_back({"receipt 1 2 3.5 2 1 1.25 7 4 0.5 \"Walk-in customer\"", std::make_unique<ReceiptCommand>()});
+
+    NullBuffer null;
+    std::printf("command_arena_bench: %zu runs per command, 5000 items, best of 5\n", runs);
+    for (const Script &s : script) {
+        size_t calls[2] = {0, 0};
+        double ms[2] = {1e300, 1e300};
+        bool failed = false;
+        auto batch = [&](bool withArena) {
+            for (size_t r = 0; r < runs && !failed; ++r) {
+                std::optional<CommandArena> scratch;
+                if (withArena) scratch.emplace(ctx);
+                auto args = tokenize(s.line, ctx.arena);
+                args.erase(args.begin());
+                Result<void> result = s.command->execute(ctx, args);
+                if (!result.ok) {
+                    std::fprintf(stderr, "%s: %s\n", s.line, result.error.c_str());
+                    failed = true;
+                }
+            }
+        };
+
+        // Modes alternate so disk and cache effects hit both alike
+        std::streambuf *console = std::cout.rdbuf(&null);
+        for (int withArena = 0; withArena < 2; ++withArena) {
+            const size_t before = heapCalls;
+            batch(withArena);
+            calls[withArena] = heapCalls - before;
+        }
+        for (int rep = 0; rep < 5; ++rep)
+            for (int withArena = 0; withArena < 2; ++withArena)
+                ms[withArena] = std::min(ms[withArena], bench::bestOf(1, [&] { batch(withArena); }));
+        std::cout.rdbuf(console);
+        if (failed) return 1;
+
+        char note[96];
+        std::snprintf(note, sizeof note, "heap calls %zu -> %zu, %.1f -> %.1f us per command",
+                      calls[0] / runs, calls[1] / runs, 1000.0 * ms[0] / runs, 1000.0 * ms[1] / runs);
+        bench::row(s.line, ms[1], note);
+    }
+
+    std::filesystem::current_path(dir.parent_path());
+    std::filesystem::remove_all(dir);
+    return 0;
+}
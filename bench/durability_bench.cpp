@@ -0,0 +1,95 @@
+//Included files
+#include "BenchUtil.h"
+#include "MutationJournal.h"
+#include "WmsControllers.h"
+
+//Needed libraries
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+// Commits per second for each durability mode. Each committer stages one
+// quantity record and flushes it, the way an autosaved `update` command
+// does; the journal is truncated between runs. The single-threaded
+// WmsControllers row adds the item insert and checkpoint policy on top.
+//   durability_bench [commits=2000] [threads=4] [dir=<temp dir>]
+// fsync cost depends on the disk under `dir`; tmpfs makes every mode cheap.
+namespace {
+    struct Mode {
+        const char *label;
+        Durability durability;
+        std::chrono::microseconds window;
+    };
+
+    // `threads` committers sharing `commits` between them
+    double journalRun(MutationJournal &journal, size_t commits, size_t threads) {
+        journal.reset();
+        return bench::bestOf(1, [&] {
+            std::vector<std::thread> committers;
+            for (size_t t = 0; t < threads; ++t) {
+                committers.emplace_back([&, t] {
+                    for (size_t c = t; c < commits; c += threads) {
+                        journal.recordQuantity(static_cast<int>(c % 1000) + 1, static_cast<int>(c));
+                        if (journal.flush()) return;
+                    }
+                });
+            }
+            for (std::thread &committer : committers) committer.join();
+        });
+    }
+
+    std::string rate(size_t commits, double ms) {
+        char text[64];
+        std::snprintf(text, sizeof text, "%10.0f commits/s", 1000.0 * static_cast<double>(commits) / ms);
+        return text;
+    }
+}
+
+int main(int argc, char **argv) {
+    const size_t commits = bench::argOr(argc, argv, 1, 2000);
+    const size_t threads = bench::argOr(argc, argv, 2, 4);
+    const std::filesystem::path dir = argc > 3 ? std::filesystem::path(argv[3])
+                                               : std::filesystem::temp_directory_path() / "wms_durability_bench";
+    std::filesystem::create_directories(dir);
+
+    const Mode modes[] = {
+        {"none", Durability::None, std::chrono::microseconds(0)},
+        {"commit", Durability::Commit, std::chrono::microseconds(0)},
+        {"group", Durability::Group, std::chrono::microseconds(0)},
+        {"group, 500 us window", Durability::Group, std::chrono::microseconds(500)},
+    };
+
+    std::printf("durability_bench: %zu commits, %zu threads, in %s\n", commits, threads, dir.string().c_str());
+    {
+        MutationJournal journal((dir / "journal_bench.json").string());
+        for (const Mode &mode : modes) {
+            journal.setDurability(mode.durability, mode.window);
+            const double one = journalRun(journal, commits, 1);
+            const double many = journalRun(journal, commits, threads);
+            bench::row(std::string(mode.label) + ", 1 thread", one, rate(commits, one));
+            bench::row(std::string(mode.label) + ", " + std::to_string(threads) + " threads", many, rate(commits, many));
+        }
+        journal.reset();
+    }
+
+    // End to end: addItem + commit() per command, as with autosave on
+    for (const Mode &mode : modes) {
+        const std::string path = (dir / "wms_bench.json").string();
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".wal");
+        WmsControllers wms(path);
+        wms.enableJournal(true);
+        wms.setDurability(mode.durability, mode.window);
+
+        const double ms = bench::bestOf(1, [&] {
+            for (size_t c = 1; c <= commits; ++c) {
+                wms.addItem(static_cast<int>(c), "Item name number " + std::to_string(c), 1, "A-01-01-01");
+                wms.commit();
+            }
+        });
+        bench::row(std::string("WmsControllers, ") + mode.label, ms, rate(commits, ms));
+    }
+
+    if (argc <= 3) std::filesystem::remove_all(dir);
+    return 0;
+}
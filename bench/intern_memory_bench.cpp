@@ -0,0 +1,109 @@
+//Included files
+#include "BenchUtil.h"
+
+//Needed libraries
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Memory report for string interning: 1M Items as stored today (location,
+// currency, unit and category as Symbols) against the same records with
+// the four fields as std::string, the layout interning replaced. Live
+// heap is counted by a global operator new hook.
+//   intern_memory_bench [items=1000000]
+
+// ─────────────────────────────────────────────
+// Live heap counter
+// ─────────────────────────────────────────────
+static size_t liveBytes = 0;
+
+void* operator new(size_t size) {
+    // Prefix each block with its size so delete can subtract it
+    void *raw = std::malloc(size + alignof(std::max_align_t));
+    if (!raw) throw std::bad_alloc();
+    *static_cast<size_t*>(raw) = size;
+    liveBytes += size;
+    return static_cast<char*>(raw) + alignof(std::max_align_t);
+}
+
+void operator delete(void *p) noexcept {
+    if (!p) return;
+    void *raw = static_cast<char*>(p) - alignof(std::max_align_t);
+    liveBytes -= *static_cast<size_t*>(raw);
+    std::free(raw);
+}
+
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+
+// The four fields before interning; everything else as in Item
+struct LegacyItem {
+    int id;
+    std::string name;
+    int quantity;
+    std::string location;
+    std::string sku;
+    double price;
+    std::string currency;
+    std::string unit;
+    std::string category;
+    std::time_t createdAt;
+    std::time_t modifiedAt;
+};
+
+namespace {
+    // Realistic mix: 420 bins, two currencies, four units, and category
+    // names long enough to leave the small-string buffer
+    const char *const CATEGORIES[] = {"fasteners-and-hardware", "electrical-components", "packaging-materials",
+                                      "safety-equipment-and-ppe", "general"};
+    const char *const UNITS[] = {"pcs", "boxes", "kilograms", "metres"};
+
+    void describe(size_t i, char (&loc)[32], const char *&currency, const char *&unit, const char *&category) {
+        const int n = static_cast<int>(i);
+        std::snprintf(loc, sizeof loc, "%c-%02d-%02d-%02d", 'A' + n % 6, n % 20 + 1, n % 7 + 1, n % 6 + 1);
+        currency = n % 10 ? "EGP" : "USD";
+        unit = UNITS[n % 4];
+        category = CATEGORIES[n % 5];
+    }
+
+    double mb(size_t bytes) { return static_cast<double>(bytes) / (1024 * 1024); }
+}
+
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+    std::printf("intern_memory_bench: %zu items (sizeof Item %zu, legacy %zu bytes)\n",
+                count, sizeof(Item), sizeof(LegacyItem));
+
+    size_t legacyBytes = 0;
+    {
+        const size_t before = liveBytes;
+        std::vector<LegacyItem> legacy;
+        legacy.reserve(count);
+        for (size_t i = 1; i <= count; ++i) {
+            char loc[32];
+            const char *currency, *unit, *category;
+            describe(i, loc, currency, unit, category);
+            legacy.push_back({static_cast<int>(i), "Item " + std::to_string(i), 1, loc, "", 1.0,
+                              currency, unit, category, 0, 0});
+        }
+        legacyBytes = liveBytes - before;
+    }
+
+    const size_t before = liveBytes;
+    const size_t poolBefore = StringPool::bytesUsed();
+    std::vector<Item> items;
+    items.reserve(count);
+    for (size_t i = 1; i <= count; ++i) {
+        char loc[32];
+        const char *currency, *unit, *category;
+        describe(i, loc, currency, unit, category);
+        items.emplace_back(static_cast<int>(i), "Item " + std::to_string(i), 1, loc, 1.0, currency, unit, category);
+    }
+    const size_t internedBytes = liveBytes - before;
+
+    std::printf("  %-34s %10.1f MB\n", "std::string fields (legacy)", mb(legacyBytes));
+    std::printf("  %-34s %10.1f MB  (pool %.2f MB, %zu strings)\n", "interned Symbols", mb(internedBytes),
+                mb(StringPool::bytesUsed() - poolBefore), StringPool::size());
+    std::printf("  %-34s %10.1f MB  (%.0f%%)\n", "saved", mb(legacyBytes - internedBytes),
+                100.0 * static_cast<double>(legacyBytes - internedBytes) / static_cast<double>(legacyBytes));
+    return 0;
+}
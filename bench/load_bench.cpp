@@ -0,0 +1,45 @@
+//Included files
+#include "BenchUtil.h"
+#include "MappedFile.h"
+
+//Needed libraries
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// JSON load: Inventory::fromJSON on one thread and on `threads`, indexes
+// included, the way startup reads inventory_data.json.
+//   load_bench [items=1000000] [threads=hardware]
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+    const size_t threads = bench::argOr(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency()));
+    const std::string path = (std::filesystem::temp_directory_path() / "wms_load_bench.json").string();
+
+    {
+        Inventory source(path);
+        bench::fillCatalog(source, count);
+        std::ofstream(path, std::ios::binary) << source.toJSON();
+    }
+    std::printf("load_bench: %zu items, %.1f MB of JSON\n", count,
+                static_cast<double>(std::filesystem::file_size(path)) / (1024 * 1024));
+
+    std::vector<size_t> runs{1};
+    if (threads > 1) runs.push_back(threads);
+    for (size_t t : runs) {
+        auto inv = std::make_unique<Inventory>(path);
+        size_t loaded = 0;
+        const double ms = bench::bestOf(1, [&] {
+            MappedFile map;
+            std::string err;
+            if (!map.open(path, err)) return;
+            loaded = inv->fromJSON(map.bytes(), t).value;
+        });
+        bench::row("fromJSON, " + std::to_string(t) + " thread(s)", ms, std::to_string(loaded) + " items");
+    }
+    std::printf("  peak RSS %ld MB\n", bench::peakRssMB());
+
+    std::filesystem::remove(path);
+    return 0;
+}
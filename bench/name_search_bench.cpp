@@ -0,0 +1,47 @@
+//Included files
+#include "BenchUtil.h"
+
+//Needed libraries
+#include <vector>
+
+// Substring name search through the trigram index against the linear
+// scan it replaced (the same Inventory with the index turned off), at
+// 10k, 100k and 1M items unless sizes are given.
+//   name_search_bench [items...]
+int main(int argc, char **argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(bench::argOr(argc, argv, i, 0));
+    if (sizes.empty()) sizes = {10000, 100000, 1000000};
+
+    struct Query {
+        const char *text;
+        bool caseInsensitive;
+    };
+    const Query queries[] = {
+        {"number 4242", false},   // A handful of hits
+        {"number 99", false},     // About 1% of the catalog
+        {"NUMBER 77", true},      // Case-insensitive
+        {"xyz", false},           // No hits
+    };
+
+    for (size_t count : sizes) {
+        Inventory inv("name_search_bench.json");
+        bench::fillCatalog(inv, count);
+        std::printf("name_search_bench: %zu items\n", count);
+
+        for (const Query &q : queries) {
+            size_t indexedHits = 0, scannedHits = 0;
+            inv.setNameIndexEnabled(true);
+            const double indexed = bench::bestOf(5, [&] { indexedHits = inv.viewByName(q.text, q.caseInsensitive).size(); });
+            inv.setNameIndexEnabled(false);
+            const double scanned = bench::bestOf(5, [&] { scannedHits = inv.viewByName(q.text, q.caseInsensitive).size(); });
+
+            const std::string label = std::string("\"") + q.text + "\"" + (q.caseInsensitive ? " (icase)" : "");
+            char note[96];
+            std::snprintf(note, sizeof note, "scan %.3f ms, %.0fx, %zu hits%s", scanned, scanned / indexed, indexedHits,
+                          indexedHits == scannedHits ? "" : " MISMATCH");
+            bench::row(label, indexed, note);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+//Included files
+#include "BenchUtil.h"
+#include "JsonItemReader.h"
+#include "MappedFile.h"
+
+//Needed libraries
+#include <filesystem>
+#include <fstream>
+
+// Streaming JSON reader on its own, without the inventory: a scan that
+// only tokenizes, then a pass that also builds every Item. Peak RSS is
+// reported against the file size (the mapped pages count towards it).
+//   parse_bench [items=1000000]
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+    const std::string path = (std::filesystem::temp_directory_path() / "wms_parse_bench.json").string();
+
+    {
+        // Written item by item so no inventory inflates the baseline
+        std::ofstream out(path, std::ios::binary);
+        out << "[";
+        for (size_t n = 1; n <= count; ++n) {
+            const int i = static_cast<int>(n);
+            char loc[32];
+            std::snprintf(loc, sizeof loc, "%c-%02d-%02d-%02d", 'A' + i % 6, i % 20 + 1, i % 7 + 1, i % 30 + 1);
+            out << (n > 1 ? "," : "") << Item(i, "Item name \\\"number\\\" " + std::to_string(i), i % 500, loc,
+                                             1.5 * (i % 100), "EGP", "pcs", "general", "SKU" + std::to_string(i)).toJSON();
+        }
+        out << "]";
+    }
+    const double fileMB = static_cast<double>(std::filesystem::file_size(path)) / (1024 * 1024);
+    std::printf("parse_bench: %zu items, %.1f MB of JSON, baseline RSS %ld MB\n", count, fileMB, bench::peakRssMB());
+
+    MappedFile map;
+    std::string err;
+    if (!map.open(path, err)) {
+        std::printf("%s\n", err.c_str());
+        return 1;
+    }
+
+    size_t seen = 0;
+    const double scanMs = bench::bestOf(3, [&] {
+        JsonItemReader reader(map.bytes());
+        ItemFields fields;
+        seen = 0;
+        while (reader.next(fields)) seen += fields.id != 0;
+    });
+    bench::row("tokenize only", scanMs, std::to_string(seen) + " objects, " +
+               std::to_string(static_cast<int>(fileMB / (scanMs / 1000.0))) + " MB/s");
+
+    const double itemMs = bench::bestOf(3, [&] {
+        JsonItemReader reader(map.bytes());
+        ItemFields fields;
+        seen = 0;
+        while (reader.next(fields)) seen += fields.toItem().getId() != 0;
+    });
+    bench::row("tokenize + build Items", itemMs, std::to_string(seen) + " items");
+    std::printf("  peak RSS %ld MB (file %.1f MB)\n", bench::peakRssMB(), fileMB);
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,51 @@
+//Included files
+#include "BenchUtil.h"
+#include "MappedFile.h"
+#include "Snapshot.h"
+
+//Needed libraries
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+// Startup from a checkpoint: Snapshot::decode of a .snap against
+// Inventory::fromJSON of the same items, plus the cost of writing each.
+//   snapshot_bench [items=1000000]
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string snapPath = (dir / "wms_snapshot_bench.snap").string();
+    const std::string jsonPath = (dir / "wms_snapshot_bench.json").string();
+
+    {
+        Inventory source(jsonPath);
+        bench::fillCatalog(source, count);
+
+        std::string image, json;
+        bench::row("Snapshot::encode", bench::bestOf(1, [&] { image = Snapshot::encode(source).value; }));
+        bench::row("Inventory::toJSON", bench::bestOf(1, [&] { json = source.toJSON(); }));
+        std::ofstream(snapPath, std::ios::binary) << image;
+        std::ofstream(jsonPath, std::ios::binary) << json;
+        std::printf("snapshot_bench: %zu items, .snap %.1f MB, JSON %.1f MB\n", count,
+                    static_cast<double>(image.size()) / (1024 * 1024), static_cast<double>(json.size()) / (1024 * 1024));
+    }
+
+    auto load = [&](const std::string &label, const std::string &path, bool binary) {
+        auto inv = std::make_unique<Inventory>(path);
+        size_t loaded = 0;
+        const double ms = bench::bestOf(1, [&] {
+            MappedFile map;
+            std::string err;
+            if (!map.open(path, err)) return;
+            loaded = binary ? Snapshot::decode(map.bytes(), *inv).value : inv->fromJSON(map.bytes()).value;
+        });
+        bench::row(label, ms, std::to_string(loaded) + " items");
+    };
+    load("startup from .snap (decode)", snapPath, true);
+    load("startup from JSON (1 thread)", jsonPath, false);
+    std::printf("  peak RSS %ld MB\n", bench::peakRssMB());
+
+    std::filesystem::remove(snapPath);
+    std::filesystem::remove(jsonPath);
+    return 0;
+}
@@ -0,0 +1,61 @@
+//Included files
+#include "BenchUtil.h"
+
+//Needed libraries
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Inventory::sortBy* (SortEngine: radix / ordered-index reads over
+// compact rows) against the implementation it replaced: copy every Item,
+// then std::sort the copies with a lambda that branches on `ascending`.
+//   sort_bench [items=1000000]
+namespace {
+    template<typename Key>
+    std::vector<Item> legacySort(const Inventory &inv, bool ascending, Key key) {
+        std::vector<Item> all = inv.getAllItems();
+        std::sort(all.begin(), all.end(), [&](const Item &a, const Item &b) {
+            return ascending ? key(a) < key(b) : key(a) > key(b);
+        });
+        return all;
+    }
+}
+
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+
+    // Shuffled IDs so sorting by ID is real work
+    std::vector<int> ids(count);
+    for (size_t i = 0; i < count; ++i) ids[i] = static_cast<int>(i + 1);
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(11));
+
+    Inventory inv("sort_bench.json");
+    inv.reserve(count);
+    for (int id : ids) {
+        char loc[32];
+        std::snprintf(loc, sizeof loc, "%c-%02d-%02d-%02d", 'A' + id % 6, id % 20 + 1, id % 7 + 1, id % 30 + 1);
+        inv.emplaceItem(id, "Item " + std::to_string((id * 7919) % 1000003), id % 500, loc);
+    }
+    std::printf("sort_bench: %zu items (legacy = copy + std::sort with a branchy lambda)\n", count);
+
+    auto compare = [&](const char *key, auto engine, auto legacy) {
+        for (bool ascending : {true, false}) {
+            size_t n = 0;
+            const double now = bench::bestOf(2, [&] { n = engine(ascending).size(); });
+            const double before = bench::bestOf(2, [&] { n = legacy(ascending).size(); });
+            char note[64];
+            std::snprintf(note, sizeof note, "legacy %.1f ms, %.1fx", before, before / now);
+            bench::row(std::string(key) + (ascending ? " asc" : " desc"), now, note);
+        }
+    };
+
+    compare("id", [&](bool asc) { return inv.sortByID(asc); },
+            [&](bool asc) { return legacySort(inv, asc, [](const Item &i) { return i.getId(); }); });
+    compare("quantity", [&](bool asc) { return inv.sortByQuantity(asc); },
+            [&](bool asc) { return legacySort(inv, asc, [](const Item &i) { return i.getQuantity(); }); });
+    compare("name", [&](bool asc) { return inv.sortByName(asc); },
+            [&](bool asc) { return legacySort(inv, asc, [](const Item &i) -> const std::string& { return i.getName(); }); });
+    compare("location", [&](bool asc) { return inv.sortByLocation(asc); },
+            [&](bool asc) { return legacySort(inv, asc, [](const Item &i) -> const std::string& { return i.getLocation(); }); });
+    return 0;
+}
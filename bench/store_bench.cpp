@@ -0,0 +1,80 @@
+//Included files
+#include "BenchUtil.h"
+#include "ItemStore.h"
+
+//Needed libraries
+#include <unordered_map>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Primary store: ItemStore (slab + flat index) against the
+// std::unordered_map<int, Item> it replaced. Insert, random lookup, full
+// scan and erase, with dense IDs and with sparse (scattered) IDs.
+//   store_bench [items=1000000]
+namespace {
+    std::vector<Item> makeItems(const std::vector<int> &ids) {
+        std::vector<Item> out;
+        out.reserve(ids.size());
+        for (int id : ids) out.emplace_back(id, "Item " + std::to_string(id), id % 500, "A-01-01-01", 1.5);
+        return out;
+    }
+
+    template<typename Store, typename Insert, typename Find, typename Scan, typename Erase>
+    void run(const char *label, const std::vector<int> &ids, Insert insert, Find find, Scan scan, Erase erase) {
+        std::vector<int> probes(ids);
+        std::shuffle(probes.begin(), probes.end(), std::mt19937(42));
+
+        Store store;
+        std::vector<Item> items = makeItems(ids);
+        const double insertMs = bench::bestOf(1, [&] { for (Item &item : items) insert(store, std::move(item)); });
+
+        long long hits = 0;
+        const double findMs = bench::bestOf(3, [&] { hits = 0; for (int id : probes) hits += find(store, id); });
+
+        long long total = 0;
+        const double scanMs = bench::bestOf(5, [&] { total = scan(store); });
+
+        const double eraseMs = bench::bestOf(1, [&] {
+            for (size_t i = 0; i < probes.size(); i += 2) erase(store, probes[i]);
+        });
+
+        std::printf("%s\n", label);
+        bench::row("insert", insertMs);
+        bench::row("lookup (random order)", findMs, std::to_string(hits) + " hits");
+        bench::row("full scan", scanMs, "sum " + std::to_string(total));
+        bench::row("erase half (random order)", eraseMs);
+    }
+
+    void compare(const std::string &shape, const std::vector<int> &ids) {
+        using Map = std::unordered_map<int, Item>;
+        run<Map>(("std::unordered_map, " + shape).c_str(), ids,
+            [](Map &m, Item &&item) { const int id = item.getId(); m.emplace(id, std::move(item)); },
+            [](const Map &m, int id) { return m.count(id); },
+            [](const Map &m) { long long s = 0; for (const auto &entry : m) s += entry.second.getQuantity(); return s; },
+            [](Map &m, int id) { m.erase(id); });
+
+        run<ItemStore>(("ItemStore, " + shape).c_str(), ids,
+            [](ItemStore &s, Item &&item) { s.insert(std::move(item)); },
+            [](const ItemStore &s, int id) { return s.find(id) != nullptr; },
+            [](const ItemStore &s) { long long sum = 0; for (const Item &item : s) sum += item.getQuantity(); return sum; },
+            [](ItemStore &s, int id) { s.erase(id); });
+    }
+}
+
+int main(int argc, char **argv) {
+    const size_t count = bench::argOr(argc, argv, 1, 1000000);
+    std::printf("store_bench: %zu items\n", count);
+
+    std::vector<int> ids(count);
+    for (size_t i = 0; i < count; ++i) ids[i] = static_cast<int>(i + 1);
+    compare("dense IDs", ids);
+
+    std::mt19937 rng(7);
+    for (int &id : ids) id = static_cast<int>(rng() & 0x7FFFFFFF);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    std::shuffle(ids.begin(), ids.end(), rng);
+    compare("sparse IDs", ids);
+    return 0;
+}
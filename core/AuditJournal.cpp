@@ -0,0 +1,126 @@
+//Included files
+#include "AuditJournal.h"
+
+//Needed libraries
+#include <algorithm>
+
+// ─────────────────────────────────────────────
+// Instance
+// ─────────────────────────────────────────────
+AuditJournal& AuditJournal::global() {
+    static AuditJournal journal;
+    return journal;
+}
+
+// ─────────────────────────────────────────────
+// Writes
+// ─────────────────────────────────────────────
+void AuditJournal::record(int itemId, AuditField field, int64_t oldValue, int64_t newValue) {
+    const int64_t now = static_cast<int64_t>(std::time(nullptr));
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (chunks.empty() || used == CHUNK_RECORDS) {
+        if (!chunks.empty() && spillOut.is_open()) spillFullChunk();
+
+        Chunk chunk;
+        chunk.records = spare ? std::move(spare) : std::make_unique<AuditRecord[]>(CHUNK_RECORDS);
+        chunk.minTs = chunk.maxTs = now;
+        chunks.push_back(std::move(chunk));
+        used = 0;
+    }
+
+    Chunk &chunk = chunks.back();
+    chunk.records[used++] = AuditRecord{now, oldValue, newValue, itemId, static_cast<uint8_t>(field), {0, 0, 0}};
+    chunk.minTs = std::min(chunk.minTs, now);
+    chunk.maxTs = std::max(chunk.maxTs, now);
+}
+
+void AuditJournal::spillFullChunk() {
+    Chunk &full = chunks.back();
+    spillOut.write(reinterpret_cast<const char*>(full.records.get()),
+                   static_cast<std::streamsize>(CHUNK_RECORDS * sizeof(AuditRecord)));
+    spillOut.flush();
+    if (!spillOut) {
+        // Keep this and later chunks in memory; spilled chunks must stay a prefix
+        spillOut.close();
+        return;
+    }
+    spare = std::move(full.records);
+}
+
+bool AuditJournal::enableSpill(const std::string& path, std::string& err) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!chunks.empty()) {
+        err = "Spilling must be enabled before the first audit record";
+        return false;
+    }
+
+    spillOut.open(path, std::ios::binary | std::ios::trunc);
+    if (!spillOut) {
+        err = "Failed to open audit spill file";
+        return false;
+    }
+    spillPath = path;
+    return true;
+}
+
+// ─────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────
+template<typename Match>
+std::vector<AuditRecord> AuditJournal::collect(Match match, int64_t from, int64_t to) const {
+    std::vector<AuditRecord> out;
+    std::unique_ptr<AuditRecord[]> buffer;
+    std::ifstream spilled;
+
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        const Chunk &chunk = chunks[c];
+        if (chunk.maxTs < from || chunk.minTs > to) continue;   // Chunk summary rules it out
+
+        // Spilled chunks are a prefix, so chunk c sits at index c in the file
+        const AuditRecord *records = chunk.records.get();
+        if (!records) {
+            if (!spilled.is_open()) spilled.open(spillPath, std::ios::binary);
+            if (!buffer) buffer = std::make_unique<AuditRecord[]>(CHUNK_RECORDS);
+            spilled.seekg(static_cast<std::streamoff>(c * CHUNK_RECORDS * sizeof(AuditRecord)));
+            spilled.read(reinterpret_cast<char*>(buffer.get()),
+                         static_cast<std::streamsize>(CHUNK_RECORDS * sizeof(AuditRecord)));
+            if (!spilled) return out;
+            records = buffer.get();
+        }
+
+        const size_t count = (c + 1 == chunks.size()) ? used : CHUNK_RECORDS;
+        for (size_t i = 0; i < count; ++i) {
+            const AuditRecord &r = records[i];
+            if (r.timestamp >= from && r.timestamp <= to && match(r)) out.push_back(r);
+        }
+    }
+    return out;
+}
+
+std::vector<AuditRecord> AuditJournal::forItem(int itemId) const {
+    std::lock_guard<std::mutex> guard(lock);
+    return collect([itemId](const AuditRecord &r) { return r.itemId == itemId; },
+                   INT64_MIN, INT64_MAX);
+}
+
+std::vector<AuditRecord> AuditJournal::between(std::time_t from, std::time_t to) const {
+    std::lock_guard<std::mutex> guard(lock);
+    return collect([](const AuditRecord &) { return true; },
+                   static_cast<int64_t>(from), static_cast<int64_t>(to));
+}
+
+size_t AuditJournal::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return chunks.empty() ? 0 : (chunks.size() - 1) * CHUNK_RECORDS + used;
+}
+
+void AuditJournal::clear() {
+    std::lock_guard<std::mutex> guard(lock);
+    chunks.clear();
+    used = 0;
+    if (spillOut.is_open()) {
+        spillOut.close();
+        spillOut.open(spillPath, std::ios::binary | std::ios::trunc);
+    }
+}
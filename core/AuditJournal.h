@@ -0,0 +1,67 @@
+#pragma once
+
+//Needed libraries
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctime>
+#include <mutex>
+
+// Which Item field an audit record describes
+enum class AuditField : uint8_t { Quantity = 1, Location = 2 };
+
+// Fixed-size binary audit record (32 bytes, written to disk as-is).
+// For Location changes, old/new values are StringPool Symbols.
+struct AuditRecord {
+    int64_t timestamp;
+    int64_t oldValue;
+    int64_t newValue;
+    int32_t itemId;
+    uint8_t field;
+    uint8_t reserved[3];
+};
+
+// Global append-only audit journal.
+//
+// Records go into fixed-size chunks, so a write is a copy into the current
+// chunk. A new chunk is allocated once per CHUNK_RECORDS writes, or never
+// while spilling, because the spilled chunk's buffer is reused. With
+// spilling enabled, full chunks are appended to a file and dropped from
+// memory. Queries transparently read them back.
+class AuditJournal {
+public:
+    static constexpr size_t CHUNK_RECORDS = 4096;
+
+    static AuditJournal& global();
+
+    void record(int itemId, AuditField field, int64_t oldValue, int64_t newValue);
+
+    std::vector<AuditRecord> forItem(int itemId) const;
+    std::vector<AuditRecord> between(std::time_t from, std::time_t to) const;   // Inclusive
+
+    bool enableSpill(const std::string& path, std::string& err);   // Truncates the file
+    size_t size() const;
+    void clear();
+
+private:
+    struct Chunk {
+        std::unique_ptr<AuditRecord[]> records;   // null once spilled
+        int64_t minTs = 0;
+        int64_t maxTs = 0;
+    };
+
+    std::vector<Chunk> chunks;
+    size_t used = 0;                               // Records in the last chunk
+    std::unique_ptr<AuditRecord[]> spare;          // Recycled buffer from the last spill
+
+    std::string spillPath;
+    std::ofstream spillOut;
+
+    mutable std::mutex lock;
+
+    void spillFullChunk();
+    template<typename Match>
+    std::vector<AuditRecord> collect(Match match, int64_t from, int64_t to) const;
+};
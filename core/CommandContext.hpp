@@ -4,9 +4,38 @@
 #include "WmsControllers.h"
 
 //Needed libraries
+#include <memory_resource>
+#include <cstddef>
 #include <string>
 
 struct CommandContext {
     WmsControllers& wms;
     bool autosave;
-};
\ No newline at end of file
+
+    // Scratch memory for the running command (see CommandArena). Anything
+    // that outlives the command must not be allocated from it.
+    std::pmr::memory_resource* arena = std::pmr::get_default_resource();
+};
+
+// Per-command bump allocator. The first INLINE_BYTES come from the stack;
+// nothing is freed individually, and everything is released at once when
+// the arena goes out of scope (and ctx.arena is restored).
+class CommandArena {
+public:
+    static constexpr size_t INLINE_BYTES = 16 * 1024;
+
+    explicit CommandArena(CommandContext& c)
+        : ctx(c), previous(c.arena), pool(buffer, sizeof(buffer)) {
+        ctx.arena = &pool;
+    }
+    ~CommandArena() { ctx.arena = previous; }
+
+    CommandArena(const CommandArena&) = delete;
+    CommandArena& operator=(const CommandArena&) = delete;
+
+private:
+    CommandContext& ctx;
+    std::pmr::memory_resource* previous;
+    alignas(std::max_align_t) std::byte buffer[INLINE_BYTES];
+    std::pmr::monotonic_buffer_resource pool;
+};
@@ -0,0 +1,158 @@
+//Included files
+#include "HotColumns.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WMS_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WMS_HAVE_AVX2 1   // Compiled with a target attribute, picked at runtime
+#include <immintrin.h>
+#endif
+
+// -----------------------------
+// Row maintenance
+// -----------------------------
+void HotColumns::push(int id, int quantity, double price) {
+    ids.push_back(id);
+    quantities.push_back(quantity);
+    prices.push_back(price);
+}
+
+void HotColumns::swapRemove(size_t row) {
+    const size_t last = ids.size() - 1;
+    if (row != last) {
+        ids[row] = ids[last];
+        quantities[row] = quantities[last];
+        prices[row] = prices[last];
+    }
+    ids.pop_back();
+    quantities.pop_back();
+    prices.pop_back();
+}
+
+void HotColumns::clear() {
+    ids.clear();
+    quantities.clear();
+    prices.clear();
+}
+
+void HotColumns::reserve(size_t count) {
+    ids.reserve(count);
+    quantities.reserve(count);
+    prices.reserve(count);
+}
+
+// -----------------------------
+// Kernels
+// -----------------------------
+// lo <= x <= hi  <=>  unsigned(x - lo) <= unsigned(hi - lo), valid for any lo <= hi.
+// The SIMD versions flip the sign bit so a signed compare does the unsigned one.
+namespace {
+    using RowsKernel = void (*)(const int32_t *, size_t, int32_t, int32_t, std::vector<uint32_t> &);
+
+    inline bool inRange(int32_t x, int32_t lo, uint32_t span) {
+        return static_cast<uint32_t>(x) - static_cast<uint32_t>(lo) <= span;
+    }
+
+    inline uint32_t spanOf(int32_t lo, int32_t hi) {
+        return static_cast<uint32_t>(hi) - static_cast<uint32_t>(lo);
+    }
+
+    // Scalar (also handles the tails of the SIMD loops)
+    void rowsRangeFrom(const int32_t *v, size_t from, size_t n, int32_t lo, int32_t hi, std::vector<uint32_t> &out) {
+        const uint32_t span = spanOf(lo, hi);
+        for (size_t i = from; i < n; ++i) {
+            if (inRange(v[i], lo, span)) out.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+#ifndef WMS_HAVE_SSE2
+    void rowsRangeScalar(const int32_t *v, size_t n, int32_t lo, int32_t hi, std::vector<uint32_t> &out) {
+        rowsRangeFrom(v, 0, n, lo, hi, out);
+    }
+#endif
+
+    inline void appendMaskRows(unsigned mask, size_t base, std::vector<uint32_t> &out) {
+        while (mask) {
+#if defined(__GNUC__)
+            unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+#else
+            unsigned bit = 0;
+            while (!(mask & (1u << bit))) ++bit;
+#endif
+            out.push_back(static_cast<uint32_t>(base + bit));
+            mask &= mask - 1;
+        }
+    }
+
+#ifdef WMS_HAVE_SSE2
+    // Bit per lane set when the value is OUT of [lo, hi]
+    inline int outOfRangeSSE2(const int32_t *v, __m128i lo, __m128i bound, __m128i flip) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(v));
+        __m128i t = _mm_xor_si128(_mm_sub_epi32(x, lo), flip);
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(t, bound)));
+    }
+
+    void rowsRangeSSE2(const int32_t *v, size_t n, int32_t lo, int32_t hi, std::vector<uint32_t> &out) {
+        const __m128i vlo = _mm_set1_epi32(lo);
+        const __m128i flip = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+        const __m128i bound = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(spanOf(lo, hi))), flip);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            unsigned hit = ~static_cast<unsigned>(outOfRangeSSE2(v + i, vlo, bound, flip)) & 0xFu;
+            appendMaskRows(hit, i, out);
+        }
+        rowsRangeFrom(v, i, n, lo, hi, out);
+    }
+
+#endif
+
+#ifdef WMS_HAVE_AVX2
+    __attribute__((target("avx2")))
+    inline unsigned outOfRangeAVX2(const int32_t *v, __m256i lo, __m256i bound, __m256i flip) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(v));
+        __m256i t = _mm256_xor_si256(_mm256_sub_epi32(x, lo), flip);
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(t, bound))));
+    }
+
+    __attribute__((target("avx2")))
+    void rowsRangeAVX2(const int32_t *v, size_t n, int32_t lo, int32_t hi, std::vector<uint32_t> &out) {
+        const __m256i vlo = _mm256_set1_epi32(lo);
+        const __m256i flip = _mm256_set1_epi32(static_cast<int32_t>(0x80000000u));
+        const __m256i bound = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(spanOf(lo, hi))), flip);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            appendMaskRows(~outOfRangeAVX2(v + i, vlo, bound, flip) & 0xFFu, i, out);
+        }
+        rowsRangeFrom(v, i, n, lo, hi, out);
+    }
+
+#endif
+
+    RowsKernel pickRowsKernel() {
+#ifdef WMS_HAVE_AVX2
+        if (__builtin_cpu_supports("avx2")) return rowsRangeAVX2;
+#endif
+#ifdef WMS_HAVE_SSE2
+        return rowsRangeSSE2;
+#else
+        return rowsRangeScalar;
+#endif
+    }
+
+    RowsKernel rowsKernel() {
+        static const RowsKernel k = pickRowsKernel();
+        return k;
+    }
+}
+
+// -----------------------------
+// Scans
+// -----------------------------
+void HotColumns::rowsWithQuantityInRange(int minQty, int maxQty, std::vector<uint32_t> &out) const {
+    out.clear();
+    if (minQty > maxQty) return;
+    rowsKernel()(quantities.data(), quantities.size(), minQty, maxQty, out);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+//Needed libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Struct-of-arrays shadow of the numeric fields that range filters,
+// sorts and top-K scans touch. Row N mirrors slot N of the ItemStore, so the owner must
+// apply every insert/erase to both in the same order (erase swaps the
+// last row into the hole, exactly like ItemStore).
+//
+// The range scan runs on SSE2/AVX2 kernels when the CPU has them, scalar otherwise.
+class HotColumns {
+private:
+    std::vector<int32_t> ids;
+    std::vector<int32_t> quantities;
+    std::vector<double> prices;
+
+public:
+    void push(int id, int quantity, double price);
+    void swapRemove(size_t row);
+    void clear();
+    void reserve(size_t count);
+
+    void setQuantity(size_t row, int quantity) { quantities[row] = quantity; }
+
+    size_t size() const { return ids.size(); }
+    int idAt(size_t row) const { return ids[row]; }
+    int quantityAt(size_t row) const { return quantities[row]; }
+    double priceAt(size_t row) const { return prices[row]; }
+
+    // Vectorized scan
+    void rowsWithQuantityInRange(int minQty, int maxQty, std::vector<uint32_t> &out) const;
+};
@@ -1,230 +1,1115 @@
 //Included files
 #include "Inventory.h"
+#include "JsonItemReader.h"
+#include "JsonPrescan.h"
+#include "SortEngine.hpp"
 #include "output.h"
 
 //Needed libraries 
 #include <algorithm>
+#include <iterator>
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <mutex>
 
 Inventory::Inventory(const std::string &filePath)
     : dataFilePath(filePath) {}
 
+// -----------------------------
+// Aggregate helpers
+// -----------------------------
+namespace {
+    long long priceCents(const Item &item) {
+        return std::llround(item.getPrice() * 100.0);
+    }
+
+    void applyDelta(StockTotals &t, long long items, long long qty, long long cents) {
+        t.items += items;
+        t.quantity += qty;
+        t.valueCents += cents;
+    }
+
+    void applyDelta(std::unordered_map<Symbol, StockTotals> &bySym, Symbol sym,
+                    long long items, long long qty, long long cents) {
+        StockTotals &t = bySym[sym];
+        applyDelta(t, items, qty, cents);
+        if (t.items == 0) bySym.erase(sym);
+    }
+
+    // Items store canonical locations; map a query's spelling onto that
+    // Symbol (nullopt if invalid or never stored)
+    std::optional<Symbol> locationSymbol(const std::string &loc) {
+        auto code = LocationCode::parse(loc);
+        if (!code) return std::nullopt;
+        return StringPool::lookup(code->toString());
+    }
+
+    StockTotals lookupTotals(const std::unordered_map<Symbol, StockTotals> &bySym, std::optional<Symbol> sym) {
+        if (!sym) return {};
+        auto it = bySym.find(*sym);
+        return it == bySym.end() ? StockTotals{} : it->second;
+    }
+
+    std::vector<std::pair<std::string, StockTotals>> namedTotals(const std::unordered_map<Symbol, StockTotals> &bySym) {
+        std::vector<std::pair<std::string, StockTotals>> out;
+        out.reserve(bySym.size());
+        for (const auto &[sym, t] : bySym) out.emplace_back(StringPool::str(sym), t);
+        std::sort(out.begin(), out.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+        return out;
+    }
+}
+
 // -----------------------------
 // Add / Remove
 // -----------------------------
-bool Inventory::addItem(const Item &item) {
-    if (items.count(item.getId()) > 0) return false;
-    items[item.getId()] = item;
+bool Inventory::addItem(Item item) {
+    if (!item.getSku().empty()) {   // SKUs are unique
+        if (findBySku(item.getSku())) return false;
+        if (bulkLoading && bulkSkus.count(item.getSku())) return false;
+    }
+
+    // From here on, index the stored copy (the argument has been moved from)
+    const Item *stored = items.insert(std::move(item));
+    if (!stored) return false;
+    hot.push(stored->getId(), stored->getQuantity(), stored->getPrice());
+    addToTotals(*stored, +1);
+    checkReorder(*stored, std::nullopt);
+
+    if (bulkLoading) {   // Indexed by endBulkLoad
+        bulkAdded.push_back(stored);
+        if (!stored->getSku().empty()) bulkSkus.emplace(stored->getSku(), stored->getId());
+        return true;
+    }
+    indexItem(*stored);
+    if (skuIndex.overlaySize() > std::max<size_t>(4096, skuIndex.staticSize() / 2)) rebuildSkuIndex();
     return true;
 }
 
 bool Inventory::removeItem(int itemId) {
-    return items.erase(itemId) > 0;
+    const Item *item = items.find(itemId);
+    if (!item) return false;
+    unindexItem(*item);
+    addToTotals(*item, -1);
+    itemReorderPoints.erase(itemId);
+
+    // Both sides swap the last entry into the hole, so rows stay aligned
+    const size_t row = static_cast<size_t>(items.slotOf(itemId));
+    items.erase(itemId);
+    hot.swapRemove(row);
+    return true;
+}
+
+// Bulk loading
+void Inventory::beginBulkLoad(size_t expected) {
+    if (bulkLoading) return;
+    bulkLoading = true;
+    reserve(items.size() + expected);
+    bulkAdded.reserve(expected);
+    bulkSkus.reserve(expected);
+}
+
+void Inventory::endBulkLoad(size_t threads) {
+    if (!bulkLoading) return;
+    bulkLoading = false;
+    std::vector<const Item*> added;
+    added.swap(bulkAdded);
+    std::unordered_map<std::string_view, int>().swap(bulkSkus);
+
+    indexBulk(added, threads);
+    rebuildSkuIndex();   // Loaded SKUs go straight into the static perfect hash
 }
 
 // Batch operations
+void Inventory::reserve(size_t count) {
+    items.reserve(count);
+    hot.reserve(count);
+}
+
 void Inventory::addMultiple(const std::vector<Item> &batch) {
+    reserve(items.size() + batch.size());
     for (const auto &item : batch) addItem(item);
 }
 
+void Inventory::addMultiple(std::vector<Item> &&batch) {
+    reserve(items.size() + batch.size());
+    for (auto &item : batch) addItem(std::move(item));
+    batch.clear();
+}
+
 void Inventory::removeMultiple(const std::vector<int> &ids) {
     for (int id : ids) removeItem(id);
 }
 
+// Stops at the first delta that would make stock negative (by throwing, like
+// changeQuantity); deltas before it stay applied
+size_t Inventory::changeQuantities(const std::vector<std::pair<int, int>> &deltas) {
+    size_t changed = 0;
+    for (const auto &[id, delta] : deltas) {
+        if (changeQuantity(id, delta)) ++changed;
+    }
+    return changed;
+}
+
+// -----------------------------
+// Index maintenance
+// -----------------------------
+bool Inventory::LocationLess::operator()(const std::pair<Symbol, int> &a, const std::pair<Symbol, int> &b) const {
+    if (a.first != b.first) {
+        int cmp = StringPool::str(a.first).compare(StringPool::str(b.first));
+        if (cmp != 0) return cmp < 0;
+    }
+    return a.second < b.second;
+}
+
+bool Inventory::LocationLess::operator()(const std::pair<Symbol, int> &a, std::string_view b) const {
+    return std::string_view(StringPool::str(a.first)) < b;
+}
+
+bool Inventory::LocationLess::operator()(std::string_view a, const std::pair<Symbol, int> &b) const {
+    return a < std::string_view(StringPool::str(b.first));
+}
+
+void Inventory::indexItem(const Item &item) {
+    const int id = item.getId();
+    locationIndex[item.getLocationId()].insert(id);
+    if (auto code = LocationCode::parse(item.getLocation())) locationTree.insert(*code, id);
+    if (!item.getSku().empty()) skuIndex.insert(item.getSku(), id);
+    if (nameIndexEnabled) nameIndex.insert(id, item.getName());
+
+    idOrder.insert(id);
+    nameOrder.emplace(item.getName(), id);
+    quantityOrder.emplace(item.getQuantity(), id);
+    locationOrder.emplace(item.getLocationId(), id);
+}
+
+// Builds every index for `added` at once: each ordered index is fed a
+// sorted run through an end hint, and each location's ID set is sized
+// before it is filled, so nothing rebalances or rehashes its way up
+void Inventory::indexBulk(std::vector<const Item*> &added, size_t threads) {
+    // Name trigrams cost the most; a spare thread builds them meanwhile
+    std::vector<std::pair<int, const std::string*>> names;
+    std::thread trigrams;
+    if (nameIndexEnabled) {
+        names.reserve(added.size());
+        for (const Item *item : added) names.emplace_back(item->getId(), &item->getName());
+        if (threads > 1) trigrams = std::thread([&] { nameIndex.insertMany(names); });
+        else nameIndex.insertMany(names);
+    }
+
+    try {
+        std::vector<std::pair<int, int>> keys;   // (key, id) runs for the numeric indexes
+        keys.reserve(added.size());
+        for (const Item *item : added) keys.emplace_back(item->getId(), item->getId());
+        std::sort(keys.begin(), keys.end());
+        for (const auto &key : keys) idOrder.emplace_hint(idOrder.end(), key.first);
+
+        keys.clear();
+        for (const Item *item : added) keys.emplace_back(item->getQuantity(), item->getId());
+        std::sort(keys.begin(), keys.end());
+        quantityOrder.insert(keys.begin(), keys.end());   // Sorted range: appends at the end hint
+
+        std::sort(added.begin(), added.end(), [](const Item *a, const Item *b) {
+            int cmp = a->getName().compare(b->getName());
+            return cmp != 0 ? cmp < 0 : a->getId() < b->getId();
+        });
+        for (const Item *item : added) nameOrder.emplace_hint(nameOrder.end(), item->getName(), item->getId());
+
+        // Rank the distinct locations by text once, then sort by rank
+        std::vector<Symbol> locations;
+        for (const Item *item : added) locations.push_back(item->getLocationId());
+        std::sort(locations.begin(), locations.end());
+        locations.erase(std::unique(locations.begin(), locations.end()), locations.end());
+        std::sort(locations.begin(), locations.end(), [](Symbol a, Symbol b) {
+            return StringPool::str(a) < StringPool::str(b);
+        });
+        std::unordered_map<Symbol, size_t> rank;
+        rank.reserve(locations.size());
+        for (size_t r = 0; r < locations.size(); ++r) rank.emplace(locations[r], r);
+
+        std::vector<std::pair<size_t, int>> byLocation;   // (rank, id)
+        byLocation.reserve(added.size());
+        for (const Item *item : added) byLocation.emplace_back(rank[item->getLocationId()], item->getId());
+        std::sort(byLocation.begin(), byLocation.end());
+
+        for (size_t i = 0; i < byLocation.size();) {
+            const Symbol loc = locations[byLocation[i].first];
+            size_t end = i;
+            while (end < byLocation.size() && byLocation[end].first == byLocation[i].first) ++end;
+
+            auto &bucket = locationIndex[loc];
+            bucket.reserve(bucket.size() + (end - i));
+            const auto code = LocationCode::parse(StringPool::str(loc));
+            for (; i < end; ++i) {
+                const int id = byLocation[i].second;
+                bucket.insert(id);
+                if (code) locationTree.insert(*code, id);
+                locationOrder.emplace_hint(locationOrder.end(), loc, id);
+            }
+        }
+    } catch (...) {
+        if (trigrams.joinable()) trigrams.join();
+        throw;
+    }
+    if (trigrams.joinable()) trigrams.join();
+}
+
+void Inventory::unindexItem(const Item &item) {
+    const int id = item.getId();
+    if (nameIndexEnabled) nameIndex.erase(id, item.getName());
+    if (auto code = LocationCode::parse(item.getLocation())) locationTree.erase(*code, id);
+    if (!item.getSku().empty()) skuIndex.erase(item.getSku(), id);
+
+    idOrder.erase(id);
+    nameOrder.erase({item.getName(), id});
+    quantityOrder.erase({item.getQuantity(), id});
+    locationOrder.erase({item.getLocationId(), id});
+
+    auto bucket = locationIndex.find(item.getLocationId());
+    if (bucket == locationIndex.end()) return;
+    bucket->second.erase(item.getId());
+    if (bucket->second.empty()) locationIndex.erase(bucket);
+}
+
+// -----------------------------
+// Updates
+// -----------------------------
+bool Inventory::setLocation(int itemId, const std::string &loc) {
+    Item *found = items.find(itemId);
+    if (!found) return false;
+
+    Item &item = *found;
+    const Symbol oldLoc = item.getLocationId();
+    item.setLocation(loc);   // throws on invalid location, before any index change
+    const Symbol newLoc = item.getLocationId();
+
+    if (auto code = LocationCode::parse(StringPool::str(oldLoc))) locationTree.erase(*code, itemId);
+    locationTree.insert(*LocationCode::parse(loc), itemId);
+
+    auto bucket = locationIndex.find(oldLoc);
+    if (bucket != locationIndex.end()) {
+        bucket->second.erase(itemId);
+        if (bucket->second.empty()) locationIndex.erase(bucket);
+    }
+    locationIndex[newLoc].insert(itemId);
+
+    locationOrder.erase({oldLoc, itemId});
+    locationOrder.emplace(newLoc, itemId);
+
+    // Move the item's contribution between location buckets
+    const long long qty = item.getQuantity();
+    const long long cents = qty * priceCents(item);
+    applyDelta(locationTotals, oldLoc, -1, -qty, -cents);
+    applyDelta(locationTotals, newLoc, +1, qty, cents);
+    return true;
+}
+
+bool Inventory::changeQuantity(int itemId, int delta) {
+    Item *item = items.find(itemId);
+    if (!item) return false;
+
+    const int oldQty = item->getQuantity();
+    item->changeQuantity(delta);   // throws on insufficient stock, before any index change
+    quantityChanged(*item, oldQty);
+    return true;
+}
+
+bool Inventory::restoreQuantity(int itemId, int quantity) {
+    Item *item = items.find(itemId);
+    if (!item) return false;
+
+    const int oldQty = item->getQuantity();
+    item->restoreQuantity(quantity);   // throws on a negative quantity, before any index change
+    quantityChanged(*item, oldQty);
+    return true;
+}
+
+void Inventory::quantityChanged(const Item &item, int oldQty) {
+    const int itemId = item.getId();
+    quantityOrder.erase({oldQty, itemId});
+    quantityOrder.emplace(item.getQuantity(), itemId);
+
+    hot.setQuantity(static_cast<size_t>(items.slotOf(itemId)), item.getQuantity());
+
+    const long long qty = item.getQuantity() - oldQty;
+    const long long cents = qty * priceCents(item);
+    applyDelta(totals, 0, qty, cents);
+    applyDelta(locationTotals, item.getLocationId(), 0, qty, cents);
+    applyDelta(categoryTotals, item.getCategoryId(), 0, qty, cents);
+
+    checkReorder(item, oldQty);
+}
+
+// -----------------------------
+// Reorder triggers
+// -----------------------------
+bool Inventory::setReorderPoint(int itemId, int threshold) {
+    if (!items.contains(itemId)) return false;
+    itemReorderPoints[itemId] = threshold;
+    return true;
+}
+
+void Inventory::clearReorderPoint(int itemId) {
+    itemReorderPoints.erase(itemId);
+}
+
+void Inventory::setCategoryReorderPoint(const std::string &category, int threshold) {
+    categoryReorderPoints[StringPool::intern(category)] = threshold;
+}
+
+void Inventory::clearCategoryReorderPoint(const std::string &category) {
+    auto sym = StringPool::lookup(category);
+    if (sym) categoryReorderPoints.erase(*sym);
+}
+
+std::optional<int> Inventory::reorderPointOf(int itemId) const {
+    auto own = itemReorderPoints.find(itemId);
+    if (own != itemReorderPoints.end()) return own->second;
+
+    const Item *item = items.find(itemId);
+    if (!item) return std::nullopt;
+    auto cat = categoryReorderPoints.find(item->getCategoryId());
+    if (cat != categoryReorderPoints.end()) return cat->second;
+    return std::nullopt;
+}
+
+void Inventory::checkReorder(const Item &item, std::optional<int> oldQty) {
+    if (itemReorderPoints.empty() && categoryReorderPoints.empty()) return;
+
+    auto threshold = reorderPointOf(item.getId());
+    if (!threshold) return;
+
+    const bool wasBelow = oldQty && *oldQty < *threshold;
+    const bool isBelow = item.getQuantity() < *threshold;
+    if (wasBelow == isBelow) return;
+
+    reorderEvents.push(ReorderEvent{
+        static_cast<int64_t>(std::time(nullptr)), item.getId(), item.getQuantity(), *threshold, isBelow
+    });
+}
+
 // -----------------------------
 // Search 
 // -----------------------------
-Item* Inventory::findItem(int itemId) {
-    auto it = items.find(itemId);
-    if (it != items.end()) return &it->second;
-    return nullptr;
+const Item* Inventory::findItem(int itemId) const {
+    return items.find(itemId);
 }
 
-std::vector<Item> Inventory::searchByName(const std::string &query) const {
-    std::vector<Item> results;
-    for (const auto &[id, item] : items) {
-        if (item.getName().find(query) != std::string::npos) {
-            results.push_back(item);
+const Item* Inventory::findBySku(std::string_view sku) const {
+    const Item *found = nullptr;
+    int id = skuIndex.find(sku, [&](int candidate, std::string_view key) {
+        // Static entries are not removed with their item, so re-check
+        found = items.find(candidate);
+        return found && found->getSku() == key;
+    });
+    if (id == SkuIndex::NOT_FOUND) return nullptr;
+    return found && found->getId() == id ? found : items.find(id);
+}
+
+void Inventory::rebuildSkuIndex() {
+    std::vector<std::pair<std::string_view, int>> entries;
+    entries.reserve(items.size());
+    for (const Item &item : items) {
+        if (!item.getSku().empty()) entries.emplace_back(item.getSku(), item.getId());
+    }
+    skuIndex.build(entries);
+}
+
+void Inventory::setNameIndexEnabled(bool enabled) {
+    if (enabled == nameIndexEnabled) return;
+    nameIndexEnabled = enabled;
+    nameIndex.clear();
+    if (!enabled) return;
+    std::vector<std::pair<int, const std::string*>> names;
+    names.reserve(items.size());
+    for (const Item &item : items) names.emplace_back(item.getId(), &item.getName());
+    nameIndex.insertMany(names);
+}
+
+ItemView Inventory::viewByName(const std::string &query, bool caseInsensitive) const {
+    const std::string needle = caseInsensitive ? TrigramIndex::fold(query) : query;
+    auto matches = [&](const Item &item) {
+        if (!caseInsensitive) return item.getName().find(needle) != std::string::npos;
+        return TrigramIndex::fold(item.getName()).find(needle) != std::string::npos;
+    };
+
+    ItemView results;
+    std::vector<int> candidates;
+    if (nameIndexEnabled && nameIndex.candidates(query, candidates)) {
+        // Index narrowed the set; verify each candidate against the real name
+        for (int id : candidates) {
+            const Item &item = items.at(id);
+            if (matches(item)) results.push_back(&item);
         }
+        return results;
+    }
+
+    for (const Item &item : items) {
+        if (matches(item)) results.push_back(&item);
     }
     return results;
 }
 
 // Filtering
-std::vector<Item> Inventory::filterByLocation(const std::string &loc) const {
-    std::vector<Item> results;
-    for (const auto &[id, item] : items) {
-        if (item.getLocation() == loc) results.push_back(item);
-    }
+ItemView Inventory::viewByLocation(const std::string &loc) const {
+    ItemView results;
+    auto sym = locationSymbol(loc);   // Never-seen locations hold no items
+    if (!sym) return results;
+
+    auto bucket = locationIndex.find(*sym);
+    if (bucket == locationIndex.end()) return results;
+
+    results.reserve(bucket->second.size());
+    for (int id : bucket->second) results.push_back(&items.at(id));
     return results;
 }
 
+ItemView Inventory::viewUnderLocation(const LocationCode &prefix) const {
+    ItemView results;
+    results.reserve(locationTree.count(prefix));
+    locationTree.visit(prefix, [&](int id) {
+        results.push_back(&items.at(id));
+        return true;
+    });
+    return results;
+}
+
+ItemView Inventory::viewByQuantity(int minQty, int maxQty) const {
+    // Vectorized scan of the quantity column; rows map 1:1 to store slots
+    std::vector<uint32_t> rows;
+    hot.rowsWithQuantityInRange(minQty, maxQty, rows);
+
+    ItemView results;
+    results.reserve(rows.size());
+    for (uint32_t row : rows) results.push_back(&items.atSlot(row));
+    return results;
+}
+
+// Copying wrappers
+static std::vector<Item> copyOf(const ItemView &view) {
+    std::vector<Item> out;
+    out.reserve(view.size());
+    for (const Item *item : view) out.push_back(*item);
+    return out;
+}
+
+std::vector<Item> Inventory::filterByLocationPrefix(const std::string &prefix) const {
+    auto code = LocationCode::parsePrefix(prefix);
+    if (!code) return {};
+    return copyOf(viewUnderLocation(*code));
+}
+
+std::vector<Item> Inventory::searchByName(const std::string &query, bool caseInsensitive) const {
+    return copyOf(viewByName(query, caseInsensitive));
+}
+
+std::vector<Item> Inventory::filterByLocation(const std::string &loc) const {
+    return copyOf(viewByLocation(loc));
+}
+
 std::vector<Item> Inventory::filterByQuantity(int minQty, int maxQty) const {
-    std::vector<Item> results;
-    for (const auto &[id, item] : items) {
-        int q = item.getQuantity();
-        if (q >= minQty && q <= maxQty) results.push_back(item);
+    return copyOf(viewByQuantity(minQty, maxQty));
+}
+
+// -----------------------------
+// Index scans (query planner)
+// -----------------------------
+namespace {
+    bool startsWith(const std::string &text, const std::string &prefix) {
+        return text.compare(0, prefix.size(), prefix) == 0;
     }
-    return results;
+}
+
+void Inventory::scanLocation(const std::string &loc, const ItemVisitor &visit) const {
+    auto sym = locationSymbol(loc);
+    if (!sym) return;
+    auto bucket = locationIndex.find(*sym);
+    if (bucket == locationIndex.end()) return;
+    for (int id : bucket->second) {
+        if (!visit(items.at(id))) return;
+    }
+}
+
+void Inventory::scanLocationPrefix(const std::string &prefix, const ItemVisitor &visit) const {
+    for (auto it = locationOrder.lower_bound(std::string_view(prefix)); it != locationOrder.end(); ++it) {
+        if (!startsWith(StringPool::str(it->first), prefix)) return;
+        if (!visit(items.at(it->second))) return;
+    }
+}
+
+void Inventory::scanLocationTree(const LocationCode &prefix, const ItemVisitor &visit) const {
+    locationTree.visit(prefix, [&](int id) { return visit(items.at(id)); });
+}
+
+void Inventory::scanQuantity(int minQty, int maxQty, bool ascending, const ItemVisitor &visit) const {
+    if (minQty > maxQty) return;
+    auto first = quantityOrder.lower_bound({minQty, std::numeric_limits<int>::min()});
+    auto last = quantityOrder.upper_bound({maxQty, std::numeric_limits<int>::max()});
+
+    if (ascending) {
+        for (auto it = first; it != last; ++it) {
+            if (!visit(items.at(it->second))) return;
+        }
+    } else {
+        for (auto it = std::make_reverse_iterator(last); it != std::make_reverse_iterator(first); ++it) {
+            if (!visit(items.at(it->second))) return;
+        }
+    }
+}
+
+void Inventory::scanOrdered(SortKey key, bool ascending, const ItemVisitor &visit) const {
+    auto walk = [&](const auto &index, auto idOf) {
+        if (ascending) {
+            for (auto it = index.begin(); it != index.end(); ++it) {
+                if (!visit(items.at(idOf(*it)))) return;
+            }
+        } else {
+            for (auto it = index.rbegin(); it != index.rend(); ++it) {
+                if (!visit(items.at(idOf(*it)))) return;
+            }
+        }
+    };
+    auto second = [](const auto &entry) { return entry.second; };
+
+    switch (key) {
+        case SortKey::ID:       walk(idOrder, [](int id) { return id; }); break;
+        case SortKey::Name:     walk(nameOrder, second); break;
+        case SortKey::Quantity: walk(quantityOrder, second); break;
+        case SortKey::Location: walk(locationOrder, second); break;
+    }
+}
+
+bool Inventory::scanNameCandidates(const std::string &query, const ItemVisitor &visit) const {
+    std::vector<int> candidates;
+    if (!nameIndexEnabled || !nameIndex.candidates(query, candidates)) return false;
+    for (int id : candidates) {
+        if (!visit(items.at(id))) break;
+    }
+    return true;
+}
+
+void Inventory::scanAll(const ItemVisitor &visit) const {
+    for (const Item &item : items) {
+        if (!visit(item)) return;
+    }
+}
+
+size_t Inventory::estimateLocation(const std::string &loc) const {
+    auto sym = locationSymbol(loc);
+    if (!sym) return 0;
+    auto bucket = locationIndex.find(*sym);
+    return bucket == locationIndex.end() ? 0 : bucket->second.size();
+}
+
+size_t Inventory::estimateLocationPrefix(const std::string &prefix, size_t cap) const {
+    size_t n = 0;
+    for (auto it = locationOrder.lower_bound(std::string_view(prefix));
+         it != locationOrder.end() && n < cap && startsWith(StringPool::str(it->first), prefix); ++it) {
+        ++n;
+    }
+    return n;
+}
+
+size_t Inventory::estimateQuantity(int minQty, int maxQty, size_t cap) const {
+    if (minQty > maxQty) return 0;
+    size_t n = 0;
+    auto last = quantityOrder.upper_bound({maxQty, std::numeric_limits<int>::max()});
+    for (auto it = quantityOrder.lower_bound({minQty, std::numeric_limits<int>::min()});
+         it != last && n < cap; ++it) {
+        ++n;
+    }
+    return n;
+}
+
+size_t Inventory::estimateName(const std::string &query) const {
+    return nameIndexEnabled ? nameIndex.estimate(query) : SIZE_MAX;
+}
+
+// -----------------------------
+// Prefix completion
+// -----------------------------
+std::vector<std::string> Inventory::completeName(const std::string &prefix, size_t limit) const {
+    std::vector<std::string> out;
+    auto it = nameOrder.lower_bound({prefix, std::numeric_limits<int>::min()});
+    while (it != nameOrder.end() && out.size() < limit && startsWith(it->first, prefix)) {
+        out.push_back(it->first);
+        // Hop over every other item sharing this name in one seek
+        it = nameOrder.upper_bound({it->first, std::numeric_limits<int>::max()});
+    }
+    return out;
+}
+
+std::vector<int> Inventory::completeId(const std::string &prefix, size_t limit) const {
+    std::vector<int> out;
+    if (prefix.empty() || prefix.size() > 10) return out;
+    if (!std::all_of(prefix.begin(), prefix.end(), [](char c) { return c >= '0' && c <= '9'; })) return out;
+
+    // IDs starting with "12" are 12, 120-129, 1200-1299, ...: one range
+    // seek per extra digit. "0" only ever matches 0 (no leading zeros).
+    const long long base = std::stoll(prefix);
+    if (base > std::numeric_limits<int>::max() || (prefix[0] == '0' && prefix.size() > 1)) return out;
+
+    long long scale = 1;
+    for (size_t width = prefix.size(); width <= 10 && out.size() < limit; ++width, scale *= 10) {
+        const long long lo = base * scale;
+        const long long hi = std::min<long long>((base + 1) * scale - 1, std::numeric_limits<int>::max());
+        if (lo > hi) break;
+
+        for (auto it = idOrder.lower_bound(static_cast<int>(lo)); it != idOrder.end() && *it <= hi && out.size() < limit; ++it)
+            out.push_back(*it);
+        if (base == 0) break;
+    }
+    return out;
 }
 
 // -----------------------------
 // Display all items
 // -----------------------------
-void Inventory::displayItems(size_t page, size_t pageSize) const {
-    std::vector<Item> allItems;
-    for (const auto &[id, item] : items) allItems.push_back(item);
+namespace {
+    // Prints one page and, if more items follow, the cursor for the next one
+    // Rows are built in `scratch` (the command's arena when called from the CLI)
+    void printPage(const ItemView &pageItems, bool hasMore, size_t pageSize, std::pmr::memory_resource *scratch) {
+        std::vector<std::string> headers = {"ID", "Name", "Quantity", "Location"};
+        OutputFormatter::TableRows rows(scratch);
+        rows.reserve(pageItems.size());
 
-    if (allItems.empty()) {
+        auto number = [](OutputFormatter::TableRow &row, int value) {
+            char buf[16];
+            auto res = std::to_chars(buf, buf + sizeof(buf), value);
+            row.emplace_back(std::string_view(buf, static_cast<size_t>(res.ptr - buf)));
+        };
+
+        for (const Item *item : pageItems) {
+            OutputFormatter::TableRow &row = rows.emplace_back();
+            row.reserve(4);
+            number(row, item->getId());
+            row.emplace_back(item->getName());
+            number(row, item->getQuantity());
+            row.emplace_back(item->getLocation());
+        }
+
+        OutputFormatter::printTable(headers, rows);
+        if (hasMore && !pageItems.empty()) {
+            OutputFormatter::printInfo("Next page: list --after " + Inventory::makeCursor(pageItems.back()->getId())
+                                       + " " + std::to_string(pageSize));
+        }
+    }
+}
+
+void Inventory::displayItems(size_t page, size_t pageSize, std::pmr::memory_resource *scratch) const {
+    if (items.empty()) {
         OutputFormatter::printWarning("No items in inventory");
         return;
     }
 
     size_t start = page * pageSize;
-    size_t end = std::min(start + pageSize, allItems.size());
-
-    if (start >= allItems.size()) {
+    if (start >= items.size()) {
         OutputFormatter::printWarning("Page out of range");
         return;
     }
 
-    std::vector<std::string> headers = {"ID", "Name", "Quantity", "Location"};
-    std::vector<std::vector<std::string>> rows;
+    printPage(viewSorted(SortKey::ID, true, start, pageSize), start + pageSize < items.size(), pageSize, scratch);
+}
+
+bool Inventory::displayItemsAfter(const std::string &cursor, size_t pageSize, std::pmr::memory_resource *scratch) const {
+    int lastId = -1;
+    if (!parseCursor(cursor, lastId)) return false;
 
-    for (size_t i = start; i < end; ++i) {
-        const Item &item = allItems[i];
-        rows.push_back({
-            std::to_string(item.getId()),
-            item.getName(),
-            std::to_string(item.getQuantity()),
-            item.getLocation()
-        });
+    bool hasMore = false;
+    ItemView pageItems = viewAfter(lastId, pageSize, &hasMore);
+    if (pageItems.empty()) {
+        OutputFormatter::printWarning("No more items");
+        return true;
     }
 
-    OutputFormatter::printTable(headers, rows);
+    printPage(pageItems, hasMore, pageSize, scratch);
+    return true;
+}
+
+// -----------------------------
+// Cursor paging
+// -----------------------------
+// Cursors name the last ID already shown, so the next page is a seek in the
+// ID index. Adding or removing other items never shifts or repeats rows.
+ItemView Inventory::viewAfter(int lastId, size_t pageSize, bool *hasMore) const {
+    ItemView out;
+    out.reserve(std::min(pageSize, items.size()));
+
+    auto it = idOrder.upper_bound(lastId);
+    for (; it != idOrder.end() && out.size() < pageSize; ++it) out.push_back(&items.at(*it));
+
+    if (hasMore) *hasMore = (it != idOrder.end());
+    return out;
+}
+
+std::string Inventory::makeCursor(int lastId) {
+    std::ostringstream ss;
+    ss << 'c' << std::hex << lastId;
+    return ss.str();
+}
+
+bool Inventory::parseCursor(const std::string &cursor, int &lastId) {
+    if (cursor.size() < 2 || cursor.size() > 9 || cursor[0] != 'c') return false;
+
+    unsigned long value = 0;
+    for (size_t i = 1; i < cursor.size(); ++i) {
+        char c = cursor[i];
+        int digit = (c >= '0' && c <= '9') ? c - '0'
+                  : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+        if (digit < 0) return false;
+        value = value * 16 + static_cast<unsigned long>(digit);
+    }
+    if (value > static_cast<unsigned long>(std::numeric_limits<int>::max())) return false;
+
+    lastId = static_cast<int>(value);
+    return true;
 }
 
 // -----------------------------
 // Sorting
 // -----------------------------
+namespace {
+    // Walks an ordered index from `offset`, handing the ID of each entry to `emit`
+    template<typename Index, typename IdOf, typename Emit>
+    void walkIndex(const Index &index, bool ascending, size_t offset, size_t limit, IdOf idOf, Emit emit) {
+        if (offset >= index.size()) return;
+        size_t n = std::min(limit, index.size() - offset);
+
+        if (ascending) {
+            auto it = std::next(index.begin(), static_cast<std::ptrdiff_t>(offset));
+            for (; n > 0; --n, ++it) emit(idOf(*it));
+        } else {
+            auto it = std::next(index.rbegin(), static_cast<std::ptrdiff_t>(offset));
+            for (; n > 0; --n, ++it) emit(idOf(*it));
+        }
+    }
+}
+
+ItemView Inventory::viewSorted(SortKey key, bool ascending, size_t offset, size_t limit) const {
+    ItemView out;
+    if (offset < items.size()) out.reserve(std::min(limit, items.size() - offset));
+
+    auto emit = [&](int id) { out.push_back(&items.at(id)); };
+    auto second = [](const auto &entry) { return entry.second; };
+
+    switch (key) {
+        case SortKey::ID:
+            walkIndex(idOrder, ascending, offset, limit, [](int id) { return id; }, emit);
+            break;
+        case SortKey::Name:
+            walkIndex(nameOrder, ascending, offset, limit, second, emit);
+            break;
+        case SortKey::Quantity:
+            walkIndex(quantityOrder, ascending, offset, limit, second, emit);
+            break;
+        case SortKey::Location:
+            walkIndex(locationOrder, ascending, offset, limit, second, emit);
+            break;
+    }
+    return out;
+}
+
+std::vector<Item> Inventory::sortedRange(SortKey key, bool ascending, size_t offset, size_t limit) const {
+    return copyOf(viewSorted(key, ascending, offset, limit));
+}
+
+// Full numeric sorts radix-sort (key, id) rows built from the contiguous
+// hot columns; that beats walking the tree index node by node. Text keys
+// stay on their ordered indexes, which are already faster than any
+// comparison sort over the whole catalog.
+template<bool Ascending>
+ItemView Inventory::columnSorted(SortKey key) const {
+    std::vector<SortEngine::IntRow> rows;
+    rows.reserve(hot.size());
+    for (uint32_t row = 0; row < hot.size(); ++row) {
+        const int k = key == SortKey::ID ? hot.idAt(row) : hot.quantityAt(row);
+        rows.push_back(SortEngine::intRow(k, hot.idAt(row), row));
+    }
+    SortEngine::sort<Ascending>(rows);
+
+    ItemView out;
+    out.reserve(rows.size());
+    for (const auto &r : rows) out.push_back(&items.atSlot(r.ref));
+    return out;
+}
+
 std::vector<Item> Inventory::sortByID(bool ascending) const {
-    std::vector<Item> sorted = getAllItems();
-    std::sort(sorted.begin(), sorted.end(),
-        [ascending](const Item &a, const Item &b) {
-            return ascending ? a.getId() < b.getId() : a.getId() > b.getId();
-        });
-    return sorted;
+    return copyOf(ascending ? columnSorted<true>(SortKey::ID) : columnSorted<false>(SortKey::ID));
 }
 
 std::vector<Item> Inventory::sortByName(bool ascending) const {
-    std::vector<Item> sorted = getAllItems();
-    std::sort(sorted.begin(), sorted.end(),
-        [ascending](const Item &a, const Item &b) {
-            return ascending ? a.getName() < b.getName() : a.getName() > b.getName();
-        });
-    return sorted;
+    return sortedRange(SortKey::Name, ascending, 0, items.size());
 }
 
 std::vector<Item> Inventory::sortByQuantity(bool ascending) const {
-    std::vector<Item> sorted = getAllItems();
-    std::sort(sorted.begin(), sorted.end(),
-        [ascending](const Item &a, const Item &b) {
-            return ascending ? a.getQuantity() < b.getQuantity() : a.getQuantity() > b.getQuantity();
-        });
-    return sorted;
+    return copyOf(ascending ? columnSorted<true>(SortKey::Quantity) : columnSorted<false>(SortKey::Quantity));
 }
 
 std::vector<Item> Inventory::sortByLocation(bool ascending) const {
-    std::vector<Item> sorted = getAllItems();
-    std::sort(sorted.begin(), sorted.end(),
-        [ascending](const Item &a, const Item &b) {
-            return ascending ? a.getLocation() < b.getLocation() : a.getLocation() > b.getLocation();
-        });
-    return sorted;
+    return sortedRange(SortKey::Location, ascending, 0, items.size());
+}
+
+// -----------------------------
+// Top-K
+// -----------------------------
+ItemView Inventory::lowestStock(size_t k) const {
+    return viewSorted(SortKey::Quantity, true, 0, k);
+}
+
+ItemView Inventory::highestStock(size_t k) const {
+    return viewSorted(SortKey::Quantity, false, 0, k);
+}
+
+ItemView Inventory::highestValue(size_t k) const {
+    k = std::min(k, hot.size());
+    if (k == 0) return {};
+
+    // Min-heap of the best K rows seen so far; the root is the weakest
+    // and gets replaced whenever a better row turns up
+    struct Entry {
+        double value;
+        int id;
+        uint32_t row;
+    };
+    auto better = [](const Entry &a, const Entry &b) {
+        return a.value != b.value ? a.value > b.value : a.id < b.id;
+    };
+
+    std::vector<Entry> heap;
+    heap.reserve(k);
+    for (size_t row = 0; row < hot.size(); ++row) {
+        Entry e{hot.quantityAt(row) * hot.priceAt(row), hot.idAt(row), static_cast<uint32_t>(row)};
+        if (heap.size() < k) {
+            heap.push_back(e);
+            std::push_heap(heap.begin(), heap.end(), better);
+        } else if (better(e, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = e;
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+
+    ItemView out;
+    out.reserve(heap.size());
+    for (const Entry &e : heap) out.push_back(&items.atSlot(e.row));
+    return out;
+}
+
+ItemView Inventory::belowReorderPoint(int reorderPoint, size_t limit) const {
+    ItemView out;
+    for (auto it = quantityOrder.begin(); it != quantityOrder.end() && out.size() < limit; ++it) {
+        if (it->first >= reorderPoint) break;
+        out.push_back(&items.at(it->second));
+    }
+    return out;
 }
 
 // -----------------------------
 // Stats
 // -----------------------------
-int Inventory::totalQuantity() const {
-    int total = 0;
-    for (const auto &[id, item] : items) total += item.getQuantity();
-    return total;
+void Inventory::addToTotals(const Item &item, long long sign) {
+    const long long qty = sign * item.getQuantity();
+    const long long cents = qty * priceCents(item);
+    applyDelta(totals, sign, qty, cents);
+    applyDelta(locationTotals, item.getLocationId(), sign, qty, cents);
+    applyDelta(categoryTotals, item.getCategoryId(), sign, qty, cents);
+}
+
+StockTotals Inventory::totalsForLocation(const std::string &loc) const {
+    return lookupTotals(locationTotals, locationSymbol(loc));
+}
+
+StockTotals Inventory::totalsForCategory(const std::string &category) const {
+    return lookupTotals(categoryTotals, StringPool::lookup(category));
+}
+
+std::vector<std::pair<std::string, StockTotals>> Inventory::totalsByLocation() const {
+    return namedTotals(locationTotals);
+}
+
+std::vector<std::pair<std::string, StockTotals>> Inventory::totalsByCategory() const {
+    return namedTotals(categoryTotals);
 }
 
 // -----------------------------
 // JSON implementation
 // -----------------------------
-void Inventory::fromJSON(const std::string &jsonData) {
-    if (jsonData.empty()) return;
-    
-    // Parse JSON array
-    std::string trimmed = jsonData;
-    // Remove leading/trailing whitespace
-    trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r"));
-    trimmed.erase(trimmed.find_last_not_of(" \t\n\r") + 1);
-    
-    if (trimmed.empty() || trimmed[0] != '[') {
-        // Try to parse as single object
-        if (trimmed[0] == '{') {
-            addItem(Item::fromJSON(trimmed));
+namespace {
+    constexpr size_t SLICES_PER_THREAD = 4;   // Small slices let merging start early
+    constexpr size_t NAMED_REJECTS = 3;       // Invalid records spelled out in the load error
+
+    // Records that do not validate: how many, and the first few by name
+    struct Rejects {
+        size_t count = 0;
+        std::vector<std::string> named;
+
+        void add(const ItemFields &fields, const char *what) {
+            if (count++ < NAMED_REJECTS)
+                named.push_back("id " + std::to_string(fields.id) + " at byte " + std::to_string(fields.offset) + ": " + what);
         }
-        return;
-    }
-    
-    // Parse array
-    size_t pos = 1; 
-    while (pos < trimmed.length()) {
-        // Skip whitespace
-        while (pos < trimmed.length() && (trimmed[pos] == ' ' || trimmed[pos] == '\t' || trimmed[pos] == '\n' || trimmed[pos] == '\r')) {
-            pos++;
+        void add(Rejects &&other) {
+            for (auto &name : other.named)
+                if (named.size() < NAMED_REJECTS) named.push_back(std::move(name));
+            count += other.count;
         }
-        
-        if (pos >= trimmed.length() || trimmed[pos] == ']') break;
-        
-        // Find object start
-        if (trimmed[pos] != '{') {
-            pos++;
-            continue;
+        std::string describe() const {
+            std::string text = std::to_string(count) + " invalid item(s), fix or remove them and load again: ";
+            for (size_t i = 0; i < named.size(); ++i) text += (i ? "; " : "") + named[i];
+            if (count > named.size()) text += "; and " + std::to_string(count - named.size()) + " more";
+            return text;
         }
-        
-        // Find matching closing brace
-        size_t objStart = pos;
-        int braceCount = 0;
-        size_t objEnd = pos;
-        
-        for (size_t i = pos; i < trimmed.length(); i++) {
-            if (trimmed[i] == '{') braceCount++;
-            else if (trimmed[i] == '}') {
-                braceCount--;
-                if (braceCount == 0) {
-                    objEnd = i;
-                    break;
+    };
+
+    // Items parsed from one slice, in file order
+    struct ParsedSlice {
+        std::vector<std::pair<Item, size_t>> items;   // (item, byte offset)
+        Rejects rejected;
+        std::string error;             // Syntax error that ended the slice, if any
+        std::exception_ptr failure;    // Anything else the worker threw, rethrown by the merger
+        bool ready = false;
+    };
+
+    // Parses slices on `workers` threads while the calling thread hands
+    // each finished slice, in order, to `consume` (which returns false to
+    // stop). Parsing runs ahead of consumption, so the two overlap. An
+    // exception in a worker reaches the calling thread when its slice
+    // comes up, after the slices before it were consumed.
+    template<typename Consume>
+    void parseSlices(std::string_view doc, const std::vector<JsonPrescan::Slice> &slices,
+                     size_t workers, Consume consume) {
+        std::vector<ParsedSlice> parsed(slices.size());
+        std::mutex lock;
+        std::condition_variable ready;
+        std::atomic<size_t> next{0};
+        std::atomic<bool> stop{false};
+
+        auto work = [&] {
+            for (;;) {
+                const size_t k = next.fetch_add(1);
+                if (k >= slices.size() || stop.load(std::memory_order_relaxed)) return;
+
+                ParsedSlice &out = parsed[k];
+                const JsonPrescan::Slice slice = slices[k];
+                JsonItemReader reader = JsonItemReader::slice(doc.substr(slice.begin, slice.end - slice.begin), slice.begin);
+                try {
+                    ItemFields fields;
+                    while (reader.next(fields)) {
+                        try {
+                            out.items.emplace_back(fields.toItem(), fields.offset);
+                        } catch (const std::invalid_argument &e) {
+                            out.rejected.add(fields, e.what());
+                        }
+                    }
+                    if (reader.failed()) out.error = reader.error();
+                } catch (...) {
+                    out.failure = std::current_exception();
                 }
+
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    out.ready = true;
+                }
+                ready.notify_all();
             }
+        };
+
+        std::vector<std::thread> pool;
+        for (size_t t = 0; t < workers; ++t) pool.emplace_back(work);
+        auto joinAll = [&] {
+            stop = true;
+            for (auto &worker : pool) worker.join();
+        };
+
+        try {
+            for (size_t k = 0; k < parsed.size(); ++k) {
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    ready.wait(guard, [&] { return parsed[k].ready; });
+                }
+                if (parsed[k].failure) std::rethrow_exception(parsed[k].failure);
+                const bool more = consume(parsed[k]);
+                std::vector<std::pair<Item, size_t>>().swap(parsed[k].items);   // Merged: release it now
+                if (!more) break;
+            }
+        } catch (...) {
+            joinAll();
+            throw;
         }
-        
-        if (braceCount == 0) {
-            std::string objStr = trimmed.substr(objStart, objEnd - objStart + 1);
-            addItem(Item::fromJSON(objStr));
-            pos = objEnd + 1;
+        joinAll();
+    }
+}
+
+Result<size_t> Inventory::fromJSON(std::string_view jsonData, size_t threads) {
+    // Records that no longer validate (e.g. legacy free-form locations)
+    // fail the load and are named in the error: skipping them would let
+    // the next checkpoint overwrite the file without them. Valid records
+    // around them are still added, as are the items before a syntax error.
+    // Records whose ID (or SKU) is already taken are skipped with a warning.
+    size_t added = 0;
+    size_t duplicates = 0;
+    Rejects rejected;
+    std::string firstDuplicate;
+    std::string error;
+
+    auto merge = [&](Item item, size_t offset) {
+        const int id = item.getId();
+        if (addItem(std::move(item))) ++added;
+        else if (duplicates++ == 0) firstDuplicate = "id " + std::to_string(id) + " at byte " + std::to_string(offset);
+    };
+
+    JsonPrescan::Split split;
+    if (threads > 1 && jsonData.size() >= PARALLEL_LOAD_MIN_BYTES)
+        split = JsonPrescan::splitArray(jsonData, threads * SLICES_PER_THREAD);
+
+    beginBulkLoad(split.objects);
+    try {
+        if (split.slices.size() > 1) {
+            parseSlices(jsonData, split.slices, threads - 1, [&](ParsedSlice &slice) {
+                for (auto &[item, offset] : slice.items) merge(std::move(item), offset);
+                rejected.add(std::move(slice.rejected));
+                error = slice.error;   // Items before a syntax error stay loaded
+                return error.empty();
+            });
         } else {
-            break;
-        }
-        
-        // Skip comma and whitespace
-        while (pos < trimmed.length() && (trimmed[pos] == ',' || trimmed[pos] == ' ' || trimmed[pos] == '\t' || trimmed[pos] == '\n' || trimmed[pos] == '\r')) {
-            pos++;
+            // Small file, one thread, or not a plain array: read it in one pass
+            JsonItemReader reader(jsonData);
+            ItemFields fields;
+            while (reader.next(fields)) {
+                try {
+                    merge(fields.toItem(), fields.offset);
+                } catch (const std::invalid_argument &e) {
+                    rejected.add(fields, e.what());
+                }
+            }
+            if (reader.failed()) error = reader.error();
         }
+    } catch (const std::exception &e) {
+        error = std::string("load aborted after ") + std::to_string(added) + " item(s): " + e.what();
     }
+    endBulkLoad(threads);   // Index whatever was merged, also after an error
+
+    if (duplicates)
+        OutputFormatter::printWarning("Skipped " + std::to_string(duplicates) + " duplicate item(s) (ID or SKU already in use); first: " + firstDuplicate);
+
+    if (rejected.count) error = rejected.describe() + (error.empty() ? "" : "; then " + error);
+    if (!error.empty()) return Result<size_t>::fail(error);
+    return Result<size_t>::success(added);
 }
 
 std::string Inventory::toJSON() const {
     std::stringstream ss;
     ss << "[";
     bool first = true;
-    for (const auto &[id, item] : items) {
+    for (const Item &item : items) {
         if (!first) ss << ",";
         ss << item.toJSON();
         first = false;
@@ -238,6 +1123,7 @@ std::string Inventory::toJSON() const {
 // -----------------------------
 std::vector<Item> Inventory::getAllItems() const {
     std::vector<Item> all;
-    for (const auto &[id, item] : items) all.push_back(item);
+    all.reserve(items.size());
+    for (const Item &item : items) all.push_back(item);
     return all;
 }
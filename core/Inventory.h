@@ -1,50 +1,250 @@
 #pragma once
 
-//Included file
+//Included files
+#include "ReorderQueue.h"
+#include "LocationTrie.h"
+#include "TrigramIndex.h"
+#include "SkuIndex.h"
+#include "HotColumns.h"
+#include "ItemStore.h"
+#include "results.hpp"
 #include "Item.h"
 
 //NEeded libraries 
 #include <unordered_map>
+#include <unordered_set>
+#include <memory_resource>
+#include <string_view>
+#include <functional>
 #include <optional>
+#include <utility>
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
+
+// Keys with a maintained ordered index
+enum class SortKey { ID, Name, Quantity, Location };
+
+// Running totals for the whole inventory or one location/category.
+// Value is kept in integer minor units (price * 100) so incremental
+// updates never drift.
+struct StockTotals {
+    long long items = 0;
+    long long quantity = 0;
+    long long valueCents = 0;
+};
+
+// Read-only pointers into the inventory. Items never move once added, so a
+// pointer stays valid until that item is removed (or the inventory is
+// reloaded); the order of a view may go stale after any mutation.
+using ItemView = std::vector<const Item*>;
+
+// Streaming callback for index scans; return false to stop early
+using ItemVisitor = std::function<bool(const Item &)>;
 
 class Inventory {
 private:
-    std::unordered_map<int, Item> items;   // ID -> Item for O(1) lookup
+    ItemStore items;   // ID -> Item, slab-backed with stable addresses
+    HotColumns hot;    // Numeric shadow of `items`, row N == slot N
     std::string dataFilePath;
 
+    // Secondary indexes (kept in sync by every mutation below)
+    std::unordered_map<Symbol, std::unordered_set<int>> locationIndex;        // Location -> IDs
+    TrigramIndex nameIndex;                                                   // Name fragments -> IDs
+    LocationTrie locationTree;                                                // Zone/aisle/rack/bin -> IDs
+    SkuIndex skuIndex;                                                        // SKU/barcode -> ID
+    bool nameIndexEnabled = true;
+
+    // Ordered indexes; ties on the key are broken by ID so ordering is total
+    std::set<int> idOrder;
+    std::set<std::pair<std::string, int>> nameOrder;
+    std::set<std::pair<int, int>> quantityOrder;
+    struct LocationLess {   // Orders interned locations by their text
+        using is_transparent = void;   // Allows seeking by plain text
+        bool operator()(const std::pair<Symbol, int> &a, const std::pair<Symbol, int> &b) const;
+        bool operator()(const std::pair<Symbol, int> &a, std::string_view b) const;
+        bool operator()(std::string_view a, const std::pair<Symbol, int> &b) const;
+    };
+    std::set<std::pair<Symbol, int>, LocationLess> locationOrder;
+
+    // Aggregates maintained on every mutation: O(1) to read
+    StockTotals totals;
+    std::unordered_map<Symbol, StockTotals> locationTotals;
+    std::unordered_map<Symbol, StockTotals> categoryTotals;
+
+    // Reorder thresholds; an item's own threshold overrides its category's
+    std::unordered_map<int, int> itemReorderPoints;
+    std::unordered_map<Symbol, int> categoryReorderPoints;
+    ReorderQueue reorderEvents;
+
+    // Bulk load state (see beginBulkLoad)
+    bool bulkLoading = false;
+    std::vector<const Item*> bulkAdded;                  // Stored but not yet indexed
+    std::unordered_map<std::string_view, int> bulkSkus;  // SKUs taken by bulkAdded
+
+    void indexItem(const Item &item);
+    void indexBulk(std::vector<const Item*> &added, size_t threads);
+    void unindexItem(const Item &item);
+    void addToTotals(const Item &item, long long sign);
+    void quantityChanged(const Item &item, int oldQty);   // Indexes, totals and reorder check
+    void checkReorder(const Item &item, std::optional<int> oldQty);   // nullopt: item is new
+    template<bool Ascending>
+    ItemView columnSorted(SortKey key) const;   // ID or Quantity via SortEngine
+
 public:
     Inventory(const std::string &filePath);
 
     // CRUD
-    bool addItem(const Item &item);               // returns false if duplicate
+    bool addItem(Item item);                      // Sink; returns false if duplicate (ID or SKU)
+    template<typename... Args>
+    bool emplaceItem(Args&&... args) {            // Builds the Item in place of a temporary + copy
+        return addItem(Item(std::forward<Args>(args)...));
+    }
     bool removeItem(int itemId);                  // returns false if not found
-    Item* findItem(int itemId);                   // returns nullptr if not found
+    const Item* findItem(int itemId) const;       // returns nullptr if not found
+    const Item* findBySku(std::string_view sku) const;   // returns nullptr if not found
+
+    // Stable handles: unlike a pointer, a handle kept past the item's
+    // removal resolves to nullptr instead of dangling (see ItemHandle)
+    ItemHandle handleOf(int itemId) const { return items.handleOf(itemId); }   // invalid if not found
+    const Item* resolve(ItemHandle handle) const { return items.resolve(handle); }
+
+    // Folds SKUs added since the last build into the static perfect hash.
+    // Runs after fromJSON and whenever the overlay outgrows half the table.
+    void rebuildSkuIndex();
+
+    // Mutations that must go through the inventory so indexes stay in sync
+    bool setLocation(int itemId, const std::string &loc);   // returns false if not found
+    bool changeQuantity(int itemId, int delta);             // returns false if not found
+    bool restoreQuantity(int itemId, int quantity);         // Journal replay: no audit entry; false if not found
+
+    // Bulk loading. Between the two calls addItem only stores the item
+    // (plus totals and hot columns) and checks ID/SKU uniqueness; the
+    // end call builds every index for the new items from sorted runs and
+    // rebuilds the SKU hash once. Nothing but addItem, findItem and
+    // totalItems may be used in between. `threads` > 1 builds the name
+    // index alongside the others.
+    void beginBulkLoad(size_t expected);
+    void endBulkLoad(size_t threads = 1);
 
     // Batch operations
+    void reserve(size_t count);                    // Pre-sizes item storage for a bulk load
     void addMultiple(const std::vector<Item> &batch);
+    void addMultiple(std::vector<Item> &&batch);   // Moves each item in
     void removeMultiple(const std::vector<int> &ids);
+    size_t changeQuantities(const std::vector<std::pair<int, int>> &deltas);   // (id, delta); returns items changed
+
+    // Reorder triggers. Every quantity change compares the old and new
+    // quantity against the item's threshold in O(1) and pushes an event
+    // when it crosses (qty < threshold counts as below). Thresholds apply
+    // to changes made after they are set.
+    bool setReorderPoint(int itemId, int threshold);   // returns false if not found
+    void clearReorderPoint(int itemId);
+    void setCategoryReorderPoint(const std::string &category, int threshold);
+    void clearCategoryReorderPoint(const std::string &category);
+    std::optional<int> reorderPointOf(int itemId) const;
+    std::vector<ReorderEvent> drainReorderEvents(size_t max = SIZE_MAX) { return reorderEvents.drain(max); }
+    size_t pendingReorderEvents() const { return reorderEvents.size(); }
+    ReorderQueue& reorderQueue() { return reorderEvents; }   // For consumers on another thread
+
+    // Display (ID order). Page numbers seek in O(page * pageSize); cursors
+    // from makeCursor resume in O(log n + pageSize)
+    // `scratch` holds the table rows; pass a command arena to skip the heap
+    void displayItems(size_t page = 0, size_t pageSize = 10,
+                      std::pmr::memory_resource *scratch = std::pmr::get_default_resource()) const;
+    bool displayItemsAfter(const std::string &cursor, size_t pageSize = 10,   // false on bad cursor
+                           std::pmr::memory_resource *scratch = std::pmr::get_default_resource()) const;
+
+    // Cursor paging: items with ID > lastId, in ID order
+    ItemView viewAfter(int lastId, size_t pageSize, bool *hasMore = nullptr) const;
+    static std::string makeCursor(int lastId);
+    static bool parseCursor(const std::string &cursor, int &lastId);
+
+    // Zero-copy queries (see ItemView for lifetime)
+    template<typename Visitor>
+    void visitItems(Visitor &&visit) const {
+        for (const Item &item : items) visit(item);
+    }
+    ItemView viewByLocation(const std::string &loc) const;
+    ItemView viewByQuantity(int minQty, int maxQty) const;
+    ItemView viewByName(const std::string &query, bool caseInsensitive = false) const;
+    ItemView viewUnderLocation(const LocationCode &prefix) const;   // "B", "B-07", ... in location order
+    ItemView viewSorted(SortKey key, bool ascending, size_t offset, size_t limit) const;
 
-    // Display & Queries
-    void displayItems(size_t page = 0, size_t pageSize = 10) const;
+    // Top-K (replenishment). Only K entries are ever allocated: stock ranks
+    // are read off the quantity index, value ranks use a bounded heap.
+    ItemView lowestStock(size_t k) const;
+    ItemView highestStock(size_t k) const;
+    ItemView highestValue(size_t k) const;                                        // quantity * price, ties by ID
+    ItemView belowReorderPoint(int reorderPoint, size_t limit = SIZE_MAX) const;  // qty < point, lowest first
+
+    // Index scans for the query planner. Each streams matching items in
+    // the index's order without copying; estimates cap their work at `cap`.
+    void scanLocation(const std::string &loc, const ItemVisitor &visit) const;
+    void scanLocationPrefix(const std::string &prefix, const ItemVisitor &visit) const;
+    void scanLocationTree(const LocationCode &prefix, const ItemVisitor &visit) const;
+    void scanQuantity(int minQty, int maxQty, bool ascending, const ItemVisitor &visit) const;
+    void scanOrdered(SortKey key, bool ascending, const ItemVisitor &visit) const;
+    bool scanNameCandidates(const std::string &query, const ItemVisitor &visit) const;   // false if unindexable
+    void scanAll(const ItemVisitor &visit) const;
+
+    size_t estimateLocation(const std::string &loc) const;
+    size_t estimateLocationPrefix(const std::string &prefix, size_t cap) const;
+    size_t estimateLocationTree(const LocationCode &prefix) const { return locationTree.count(prefix); }   // Exact
+    size_t estimateQuantity(int minQty, int maxQty, size_t cap) const;
+    size_t estimateName(const std::string &query) const;   // SIZE_MAX if unindexable
+
+    // Prefix completion, read off the ordered name/ID indexes: O(log n + limit)
+    std::vector<std::string> completeName(const std::string &prefix, size_t limit) const;   // Distinct names, sorted
+    std::vector<int> completeId(const std::string &prefix, size_t limit) const;             // Decimal prefix, shortest first
+
+    // Copying queries (built on the views above)
     std::vector<Item> filterByLocation(const std::string &loc) const;
+    std::vector<Item> filterByLocationPrefix(const std::string &prefix) const;   // Whole segments; empty if invalid
     std::vector<Item> filterByQuantity(int minQty, int maxQty) const;
-    std::vector<Item> searchByName(const std::string &query) const;
+    std::vector<Item> searchByName(const std::string &query, bool caseInsensitive = false) const;
+
+    // Trigram index behind searchByName (on by default, rebuilt when re-enabled)
+    void setNameIndexEnabled(bool enabled);
+    bool isNameIndexEnabled() const { return nameIndexEnabled; }
+
+    // Ordered slice read straight from the maintained index: O(offset + limit)
+    std::vector<Item> sortedRange(SortKey key, bool ascending, size_t offset, size_t limit) const;
 
-    // Sorting (return sorted copies)
+    // Sorting (return sorted copies; ID/Quantity are radix-sorted from the
+    // hot columns, Name/Location read from the ordered indexes)
     std::vector<Item> sortByID(bool ascending = true) const;
     std::vector<Item> sortByName(bool ascending = true) const;
     std::vector<Item> sortByQuantity(bool ascending = true) const;
     std::vector<Item> sortByLocation(bool ascending = true) const;
 
     // JSON
-    void fromJSON(const std::string &jsonData);
+    // Streams items out of `jsonData` (see JsonItemReader); returns items
+    // added, or the first syntax error with its byte offset. Records that
+    // fail validation also fail the load and are named in the error. With
+    // threads > 1, large arrays are split by JsonPrescan and parsed on
+    // threads - 1 workers while this thread merges slices in file order,
+    // so the result (and which duplicate wins) matches a serial load.
+    // Either way the indexes are built in bulk once the items are in; a
+    // failure other than a bad record (e.g. out of memory in a worker)
+    // ends the load like a syntax error, keeping what was merged.
+    static constexpr size_t PARALLEL_LOAD_MIN_BYTES = size_t(1) << 20;
+    Result<size_t> fromJSON(std::string_view jsonData, size_t threads = 1);
     std::string toJSON() const;
 
-    // Stats
+    // Stats (maintained aggregates; range counts scan the hot columns)
     size_t totalItems() const { return items.size(); }
-    int totalQuantity() const;
+    SlabStats storageStats() const { return items.slabStats(); }
+    bool denseIdIndex() const { return items.isDense(); }
+    long long totalQuantity() const { return totals.quantity; }
+    double totalValue() const { return static_cast<double>(totals.valueCents) / 100.0; }
+    const StockTotals& stockTotals() const { return totals; }
+    StockTotals totalsForLocation(const std::string &loc) const;
+    StockTotals totalsForCategory(const std::string &category) const;
+    std::vector<std::pair<std::string, StockTotals>> totalsByLocation() const;
+    std::vector<std::pair<std::string, StockTotals>> totalsByCategory() const;
+    std::map<uint16_t, size_t> locationBreakdown(const LocationCode &prefix) const { return locationTree.children(prefix); }
 
     // Access raw items (for advanced use)
     std::vector<Item> getAllItems() const;
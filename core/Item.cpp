@@ -1,15 +1,22 @@
 //Included files
+#include "JsonItemReader.h"
+#include "AuditJournal.h"
+#include "LocationCode.h"
 #include "Item.h"
 #include "output.h"
 
 //Needed libraries
+#include <string_view>
 #include <stdexcept>
 #include <algorithm>
+#include <charconv>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <utility>
 #include <vector>
 #include <cctype>
+#include <cmath>
 using namespace std;
 
 // ─────────────────────────────────────────────
@@ -21,15 +28,23 @@ void Item::touch() {
 }
 
 bool Item::isValidLocation(const std::string& loc) {
-    // Minimal validation for now
-    return !loc.empty();
+    // ZONE-AISLE-RACK-BIN (see LocationCode)
+    return LocationCode::parse(loc).has_value();
+}
+
+// Locations are stored in canonical form ("b-7-3-12" -> "B-07-03-12"), so
+// every spelling of one bin shares a Symbol and all location indexes agree
+static Symbol internLocation(std::string_view loc) {
+    auto code = LocationCode::parse(loc);
+    if (!code) throw std::invalid_argument("Invalid location \"" + std::string(loc) + "\" (expected ZONE-AISLE-RACK-BIN)");
+    return StringPool::intern(code->toString());
 }
 
 void Item::validate() const {
     if (id < 0) throw std::invalid_argument("Item id must be non-negative");
     if (quantity < 0) throw std::invalid_argument("Item quantity must be non-negative");
     if (name.empty()) throw std::invalid_argument("Item name must not be empty");
-    if (!isValidLocation(location)) throw std::invalid_argument("Invalid location");
+    if (!isValidLocation(StringPool::str(location))) throw std::invalid_argument("Invalid location (expected ZONE-AISLE-RACK-BIN)");
 }
 
 // ─────────────────────────────────────────────
@@ -38,21 +53,23 @@ void Item::validate() const {
 
 Item::Item(
     int id,
-    const std::string& name,
+    std::string name,
     int qty,
-    const std::string& loc,
+    std::string_view loc,
     double price,
-    const std::string& currency,
-    const std::string& unit,
-    const std::string& category)
+    std::string_view currency,
+    std::string_view unit,
+    std::string_view category,
+    std::string sku)
     : id(id),
-      name(name),
+      name(std::move(name)),
       quantity(qty),
-      location(loc),
+      location(internLocation(loc)),
+      sku(std::move(sku)),
       price(price),
-      currency(currency),
-      unit(unit),
-      category(category) {
+      currency(StringPool::intern(currency)),
+      unit(StringPool::intern(unit)),
+      category(StringPool::intern(category)) {
     createdAt = modifiedAt = std::time(nullptr);
     validate();
 }
@@ -64,18 +81,18 @@ Item::Item(
 int Item::getId() const { return id; }
 const std::string& Item::getName() const { return name; }
 int Item::getQuantity() const { return quantity; }
-const std::string& Item::getLocation() const { return location; }
+const std::string& Item::getLocation() const { return StringPool::str(location); }
 double Item::getPrice() const { return price; }
-const std::string& Item::getCurrency() const { return currency; }
-const std::string& Item::getUnit() const { return unit; }
-const std::string& Item::getCategory() const { return category; }
+const std::string& Item::getCurrency() const { return StringPool::str(currency); }
+const std::string& Item::getUnit() const { return StringPool::str(unit); }
+const std::string& Item::getCategory() const { return StringPool::str(category); }
 std::time_t Item::getCreatedAt() const { return createdAt; }
 std::time_t Item::getModifiedAt() const { return modifiedAt; }
 
 void Item::setLocation(const std::string& loc) {
-    if (!isValidLocation(loc)) throw std::invalid_argument("Invalid location");
-    location = loc;
-    auditLog.push_back("Location -> " + location);
+    const Symbol old = location;
+    location = internLocation(loc);
+    AuditJournal::global().record(id, AuditField::Location, old, location);
     touch();
 }
 
@@ -88,13 +105,14 @@ bool Item::operator<(const Item& o) const { return id < o.id; }
 
 // Print Item Details (Improved)
 void printItem(const Item& item) {
-    std::vector<std::string> headers = {"ID", "Name", "Quantity", "Location" , "Currency"};
+    std::vector<std::string> headers = {"ID", "Name", "Quantity", "Location" , "Currency", "SKU"};
     std::vector<std::vector<std::string>> rows = {{
         std::to_string(item.getId()),
         item.getName(),
         std::to_string(item.getQuantity()),
         item.getLocation(),
-        item.getCurrency()
+        item.getCurrency(),
+        item.getSku().empty() ? "-" : item.getSku()
     }};
     OutputFormatter::printTable(headers, rows);
 }
@@ -102,9 +120,15 @@ void printItem(const Item& item) {
 // Constructor for item class quantity validation
 void Item::changeQuantity(int delta) {
     int old = quantity;
-    quantity += delta;
-    if (quantity < 0) throw std::invalid_argument("Insufficient stock");
-    auditLog.push_back("Qty " + std::to_string(old) + " -> " + std::to_string(quantity));
+    if (old + delta < 0) throw std::invalid_argument("Insufficient stock");
+    quantity = old + delta;
+    AuditJournal::global().record(id, AuditField::Quantity, old, quantity);
+    touch();
+}
+
+void Item::restoreQuantity(int value) {
+    if (value < 0) throw std::invalid_argument("Item quantity must be non-negative");
+    quantity = value;
     touch();
 }
 
@@ -122,8 +146,9 @@ static std::string escapeJSON(const std::string& str) {
             case '\r': ss << "\\r"; break;
             case '\t': ss << "\\t"; break;
             default:
-                if (c < 0x20) {
-                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c;
+                // Bytes >= 0x80 (UTF-8) pass through; char may be signed
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
                 } else {
                     ss << c;
                 }
@@ -133,124 +158,32 @@ static std::string escapeJSON(const std::string& str) {
     return ss.str();
 }
 
-// JSON helper: unescape JSON string
-static std::string unescapeJSON(const std::string& str) {
-    std::string result;
-    for (size_t i = 0; i < str.length(); ++i) {
-        if (str[i] == '\\' && i + 1 < str.length()) {
-            switch (str[i + 1]) {
-                case '"': result += '"';  i++; break;
-                case '\\':result += '\\'; i++; break;
-                case '/': result += '/';  i++; break;
-                case 'b': result += '\b'; i++; break;
-                case 'f': result += '\f'; i++; break;
-                case 'n': result += '\n'; i++; break;
-                case 'r': result += '\r'; i++; break;
-                case 't': result += '\t'; i++; break;
-                case 'u':
-                
-                    // Simple unicode escape (basic support)
-                    if (i + 5 < str.length()) {
-                        result += '?'; // Placeholder for unicode
-                        i += 5;
-                    }
-                    break;
-                default: result += str[i]; break;
-            }
-        } else {
-            result += str[i];
-        }
-    }
-    return result;
-}
-
 // JSON Serialization
 std::string Item::toJSON() const {
+    // Shortest text that reads back as the same double; JSON has no NaN/inf
+    char priceText[32];
+    const auto printed = std::to_chars(priceText, priceText + sizeof(priceText), std::isfinite(price) ? price : 0.0);
+
     std::stringstream ss;
     ss << "{"
        << "\"id\":" << id << ","
        << "\"name\":\"" << escapeJSON(name) << "\","
        << "\"quantity\":" << quantity << ","
-       << "\"location\":\"" << escapeJSON(location) << "\""
-       << "}";
+       << "\"location\":\"" << escapeJSON(getLocation()) << "\","
+       << "\"price\":" << std::string_view(priceText, printed.ptr - priceText) << ","
+       << "\"currency\":\"" << escapeJSON(getCurrency()) << "\","
+       << "\"unit\":\"" << escapeJSON(getUnit()) << "\","
+       << "\"category\":\"" << escapeJSON(getCategory()) << "\"";
+    if (!sku.empty()) ss << ",\"sku\":\"" << escapeJSON(sku) << "\"";
+    ss << "}";
     return ss.str();
 }
 
-// JSON Deserialization
-Item Item::fromJSON(const std::string& jsonStr) {
-    int id = 0;
-    std::string name;
-    int quantity = 0;
-    std::string location;
-
-    // Simple JSON parser - find key-value pairs
-    size_t pos = 0;
-    while (pos < jsonStr.length()) {
-        // Find key
-        size_t keyStart = jsonStr.find('"', pos);
-        if (keyStart == std::string::npos) break;
-        size_t keyEnd = jsonStr.find('"', keyStart + 1);
-        if (keyEnd == std::string::npos) break;
-        std::string key = jsonStr.substr(keyStart + 1, keyEnd - keyStart - 1);
-
-        // Find colon
-        size_t colonPos = jsonStr.find(':', keyEnd);
-        if (colonPos == std::string::npos) break;
-
-        // Find value
-        size_t valueStart = colonPos + 1;
-        while (valueStart < jsonStr.length() && (jsonStr[valueStart] == ' ' || jsonStr[valueStart] == '\t')) {
-            valueStart++;
-        }
-
-        if (valueStart >= jsonStr.length()) break;
-
-        if (jsonStr[valueStart] == '"') {
-            // String value
-            size_t valueEnd = valueStart + 1;
-            bool escaped = false;
-            while (valueEnd < jsonStr.length()) {
-                if (escaped) {
-                    escaped = false;
-                    valueEnd++;
-                    continue;
-                }
-                if (jsonStr[valueEnd] == '\\') {
-                    escaped = true;
-                    valueEnd++;
-                    continue;
-                }
-                if (jsonStr[valueEnd] == '"') {
-                    break;
-                }
-                valueEnd++;
-            }
-            std::string value = unescapeJSON(jsonStr.substr(valueStart + 1, valueEnd - valueStart - 1));
-            
-            if (key == "name") name = value;
-            else if (key == "location") location = value;
-            
-            pos = valueEnd + 1;
-        } else {
-            // Numeric value
-            size_t valueEnd = valueStart;
-            while (valueEnd < jsonStr.length() && 
-                   (isdigit(jsonStr[valueEnd]) || jsonStr[valueEnd] == '-' || jsonStr[valueEnd] == '+')) {
-                valueEnd++;
-            }
-            int value = std::stoi(jsonStr.substr(valueStart, valueEnd - valueStart));
-            
-            if (key == "id") id = value;
-            else if (key == "quantity") quantity = value;
-            
-            pos = valueEnd;
-        }
-
-        // Skip comma and whitespace
-        while (pos < jsonStr.length() && (jsonStr[pos] == ',' || jsonStr[pos] == ' ' || jsonStr[pos] == '\t')) {
-            pos++;
-        }
-    }
-
-    return Item(id, name, quantity, location);
+// JSON Deserialization (first object of `json`; see JsonItemReader)
+Item Item::fromJSON(std::string_view json) {
+    JsonItemReader reader(json);
+    ItemFields fields;
+    if (!reader.next(fields))
+        throw std::invalid_argument(reader.failed() ? reader.error() : "No item object");
+    return fields.toItem();
 }
\ No newline at end of file
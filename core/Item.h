@@ -1,6 +1,10 @@
 #pragma once
 
+//needed file inclusion
+#include "StringPool.h"
+
 //needed libraries
+#include <string_view>
 #include <string>
 #include <vector>
 #include <ctime>
@@ -12,36 +16,40 @@ private:
     int id;
     std::string name;
     int quantity;
-    std::string location;
+    Symbol location;    // Interned in StringPool
+    std::string sku;    // Optional scanner key (SKU/barcode); empty if none
 
     double price;
-    std::string currency;
-    std::string unit;
-    std::string category;
+    Symbol currency;
+    Symbol unit;
+    Symbol category;
 
     std::time_t createdAt;
-    std::time_t modifiedAt;
-    std::vector<std::string> auditLog;
+    std::time_t modifiedAt;   // Change history lives in AuditJournal
 
     void touch();
     void validate() const;
-    static bool isValidLocation(const std::string& loc);
 
 // Public interface
 public:
-    // Constructors
+    // Constructors. Owned strings are sinks (pass an rvalue to move it in);
+    // interned fields only need a view.
     Item() = default;
     Item(int id,
-         const std::string& name,
+         std::string name,
          int qty,
-         const std::string& loc,
+         std::string_view loc,
          double price = 0.0,
-         const std::string& currency = "EGP",
-         const std::string& unit = "pcs",
-         const std::string& category = "general");
+         std::string_view currency = "EGP",
+         std::string_view unit = "pcs",
+         std::string_view category = "general",
+         std::string sku = "");
          
+    // ZONE-AISLE-RACK-BIN, e.g. "B-07-03-12" (see LocationCode)
+    static bool isValidLocation(const std::string& loc);
+
     // JSON Serialization / Deserialization
-    static Item fromJSON(const std::string& jsonStr);
+    static Item fromJSON(std::string_view json);   // Throws std::invalid_argument on bad input
     std::string toJSON() const;
 
     // Getters and Setters for data members
@@ -49,13 +57,19 @@ public:
     const std::string& getName() const;
     int getQuantity() const;
     const std::string& getLocation() const;
+    const std::string& getSku() const { return sku; }
     double getPrice() const;
     const std::string& getCurrency() const;
     const std::string& getUnit() const;
     const std::string& getCategory() const;
+    Symbol getLocationId() const { return location; }
+    Symbol getCurrencyId() const { return currency; }
+    Symbol getUnitId() const { return unit; }
+    Symbol getCategoryId() const { return category; }
     std::time_t getCreatedAt() const;
     std::time_t getModifiedAt() const;
     void changeQuantity(int delta);
+    void restoreQuantity(int value);   // Journal replay: the change was audited when first made
     void setLocation(const std::string& loc);
 
     bool operator==(const Item& o) const;
@@ -0,0 +1,92 @@
+//Included files
+#include "ItemSlab.h"
+
+//Needed libraries
+#include <new>
+
+// ─────────────────────────────────────────────
+// Chunks
+// ─────────────────────────────────────────────
+ItemSlab::~ItemSlab() {
+    clear();
+}
+
+void ItemSlab::addChunk() {
+    const uint32_t base = static_cast<uint32_t>(chunks.size() * CHUNK_ITEMS);
+    chunks.push_back(std::make_unique<Cell[]>(CHUNK_ITEMS));
+    generations.resize(generations.size() + CHUNK_ITEMS, 0);
+
+    // Push in reverse so the lowest cell is handed out first
+    for (uint32_t i = CHUNK_ITEMS; i-- > 0;) freeCells.push_back(base + i);
+}
+
+void ItemSlab::reserve(size_t count) {
+    while (chunks.size() * CHUNK_ITEMS < count) addChunk();
+}
+
+// ─────────────────────────────────────────────
+// Allocation
+// ─────────────────────────────────────────────
+ItemHandle ItemSlab::create(Item &&item) {
+    if (freeCells.empty()) addChunk();
+
+    const uint32_t index = freeCells.back();
+    new (cell(index)) Item(std::move(item));   // May throw; the cell stays free if it does
+    freeCells.pop_back();
+    if (index >= highWater) highWater = index + 1;
+
+    ++generations[index];   // Even -> odd: live
+    ++liveCount;
+    return ItemHandle{index, generations[index]};
+}
+
+void ItemSlab::destroy(ItemHandle handle) {
+    if (!get(handle)) return;
+
+    cell(handle.index)->~Item();
+    ++generations[handle.index];   // Odd -> even: stale handles stop resolving
+    freeCells.push_back(handle.index);
+    --liveCount;
+}
+
+void ItemSlab::clear() {
+    for (uint32_t index = 0; index < generations.size(); ++index) {
+        if (isLive(index)) cell(index)->~Item();
+    }
+    chunks.clear();
+    generations.clear();
+    freeCells.clear();
+    liveCount = 0;
+    highWater = 0;
+}
+
+Item* ItemSlab::get(ItemHandle handle) {
+    if (handle.index >= generations.size() || generations[handle.index] != handle.generation || !isLive(handle.index))
+        return nullptr;
+    return cell(handle.index);
+}
+
+const Item* ItemSlab::get(ItemHandle handle) const {
+    return const_cast<ItemSlab*>(this)->get(handle);
+}
+
+// ─────────────────────────────────────────────
+// Diagnostics
+// ─────────────────────────────────────────────
+SlabStats ItemSlab::stats() const {
+    SlabStats s;
+    s.chunks = chunks.size();
+    s.capacity = generations.size();
+    s.live = liveCount;
+    s.free = s.capacity - s.live;
+    s.fragmented = highWater - s.live;
+    s.bytesReserved = s.capacity * sizeof(Cell) + generations.capacity() * sizeof(uint32_t)
+                    + freeCells.capacity() * sizeof(uint32_t);
+
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        size_t live = 0;
+        for (size_t i = c * CHUNK_ITEMS; i < (c + 1) * CHUNK_ITEMS; ++i) live += isLive(static_cast<uint32_t>(i));
+        if (live == 0) ++s.emptyChunks;
+    }
+    return s;
+}
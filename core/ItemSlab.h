@@ -0,0 +1,81 @@
+#pragma once
+
+//Included file
+#include "Item.h"
+
+//Needed libraries
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Stable reference to an Item in an ItemSlab. The generation makes a
+// handle to a destroyed item resolve to nullptr instead of to whatever
+// reuses its cell.
+struct ItemHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool valid() const { return index != UINT32_MAX; }
+    bool operator==(const ItemHandle &o) const { return index == o.index && generation == o.generation; }
+};
+
+// Allocation counters reported by the `diag` command
+struct SlabStats {
+    size_t chunks = 0;
+    size_t capacity = 0;        // Cells across all chunks
+    size_t live = 0;
+    size_t free = 0;
+    size_t fragmented = 0;      // Holes left by removals (free cells below the high-water mark)
+    size_t emptyChunks = 0;     // Chunks with no live items at all
+    size_t bytesReserved = 0;
+};
+
+// Pool allocator for Item records.
+//
+// Items are constructed in place in fixed-size chunks that are never moved
+// or freed while the slab lives, so an Item's address stays the same until
+// that item is destroyed, whatever else is added or removed. Destroyed
+// cells go on a LIFO free list and are reused before a new chunk is
+// allocated, so add/remove churn does not touch the general heap.
+class ItemSlab {
+public:
+    static constexpr size_t CHUNK_ITEMS = 1024;
+
+    ItemSlab() = default;
+    ItemSlab(const ItemSlab &) = delete;
+    ItemSlab& operator=(const ItemSlab &) = delete;
+    ~ItemSlab();
+
+    ItemHandle create(Item &&item);   // Moves the item into a free cell
+    void destroy(ItemHandle handle);
+    void clear();
+    void reserve(size_t count);   // Pre-allocates chunks
+
+    // Checked: nullptr for a stale or invalid handle
+    Item* get(ItemHandle handle);
+    const Item* get(ItemHandle handle) const;
+
+    // Unchecked, for handles the caller knows are live
+    Item& at(ItemHandle handle) { return *cell(handle.index); }
+    const Item& at(ItemHandle handle) const { return *cell(handle.index); }
+
+    size_t size() const { return liveCount; }
+    SlabStats stats() const;
+
+private:
+    struct alignas(Item) Cell {
+        unsigned char bytes[sizeof(Item)];
+    };
+
+    std::vector<std::unique_ptr<Cell[]>> chunks;
+    std::vector<uint32_t> generations;   // Per cell; odd while the cell is live
+    std::vector<uint32_t> freeCells;     // LIFO: holes are reused before untouched cells
+    size_t liveCount = 0;
+    size_t highWater = 0;                // Cells [0, highWater) have been used at least once
+
+    Item* cell(uint32_t index) const {
+        return reinterpret_cast<Item*>(chunks[index / CHUNK_ITEMS][index % CHUNK_ITEMS].bytes);
+    }
+    bool isLive(uint32_t index) const { return (generations[index] & 1u) != 0; }
+    void addChunk();
+};
@@ -0,0 +1,196 @@
+//Included files
+#include "ItemStore.h"
+
+//Needed libraries
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+
+// -----------------------------
+// Index helpers
+// -----------------------------
+bool ItemStore::fitsDense(size_t count) const {
+    return static_cast<size_t>(maxId) < DENSE_SLACK + DENSE_FACTOR * count;
+}
+
+size_t ItemStore::bucketOf(int id) const {
+    // Fibonacci hashing spreads sequential IDs across the table
+    uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(id)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h >> 32) & (table.size() - 1);
+}
+
+int32_t ItemStore::slotOf(int id) const {
+    if (id < 0) return EMPTY;
+    if (dense) {
+        size_t key = static_cast<size_t>(id);
+        return key < direct.size() ? direct[key] : EMPTY;
+    }
+
+    if (table.empty()) return EMPTY;
+    for (size_t b = bucketOf(id); ; b = (b + 1) & (table.size() - 1)) {
+        if (table[b].slot == EMPTY) return EMPTY;
+        if (table[b].id == id) return table[b].slot;
+    }
+}
+
+void ItemStore::setSlot(int id, int32_t slot) {
+    if (dense) {
+        direct[static_cast<size_t>(id)] = slot;
+        return;
+    }
+    for (size_t b = bucketOf(id); ; b = (b + 1) & (table.size() - 1)) {
+        if (table[b].id == id && table[b].slot != EMPTY) {
+            table[b].slot = slot;
+            return;
+        }
+    }
+}
+
+void ItemStore::tableInsert(int id, int32_t slot) {
+    // Keep the load factor at or below 0.7
+    if ((slots.size() + 1) * 10 > table.size() * 7) growTable();
+    if (dense) {
+        direct[static_cast<size_t>(id)] = slot;
+        return;
+    }
+
+    size_t b = bucketOf(id);
+    while (table[b].slot != EMPTY) b = (b + 1) & (table.size() - 1);
+    table[b] = {id, slot};
+}
+
+void ItemStore::tableErase(int id) {
+    const size_t mask = table.size() - 1;
+    size_t hole = bucketOf(id);
+    while (table[hole].id != id || table[hole].slot == EMPTY) hole = (hole + 1) & mask;
+
+    // Backward-shift deletion: pull later entries of the probe run into the hole
+    for (size_t next = (hole + 1) & mask; table[next].slot != EMPTY; next = (next + 1) & mask) {
+        size_t home = bucketOf(table[next].id);
+        bool movable = (hole <= next) ? (home <= hole || home > next)
+                                      : (home <= hole && home > next);
+        if (movable) {
+            table[hole] = table[next];
+            hole = next;
+        }
+    }
+    table[hole].slot = EMPTY;
+}
+
+void ItemStore::growTable() {
+    // IDs filled in since the last rehash: go back to direct indexing
+    if (!table.empty() && fitsDense(slots.size() + 1)) {
+        switchToDense();
+        return;
+    }
+
+    size_t capacity = table.empty() ? 16 : table.size() * 2;
+    while (slots.size() * 10 >= capacity * 7) capacity *= 2;
+
+    table.assign(capacity, Bucket{0, EMPTY});
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const int id = slots[i].item->getId();
+        size_t b = bucketOf(id);
+        while (table[b].slot != EMPTY) b = (b + 1) & (capacity - 1);
+        table[b] = {id, static_cast<int32_t>(i)};
+    }
+}
+
+void ItemStore::switchToSparse() {
+    dense = false;
+    std::vector<int32_t>().swap(direct);
+    table.clear();
+    growTable();
+}
+
+void ItemStore::switchToDense() {
+    dense = true;
+    std::vector<Bucket>().swap(table);
+    direct.assign(static_cast<size_t>(maxId) + 1, EMPTY);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        direct[static_cast<size_t>(slots[i].item->getId())] = static_cast<int32_t>(i);
+    }
+}
+
+// -----------------------------
+// Lookup
+// -----------------------------
+Item* ItemStore::find(int id) {
+    int32_t slot = slotOf(id);
+    return slot == EMPTY ? nullptr : slots[static_cast<size_t>(slot)].item;
+}
+
+const Item* ItemStore::find(int id) const {
+    int32_t slot = slotOf(id);
+    return slot == EMPTY ? nullptr : slots[static_cast<size_t>(slot)].item;
+}
+
+ItemHandle ItemStore::handleOf(int id) const {
+    int32_t slot = slotOf(id);
+    return slot == EMPTY ? ItemHandle{} : slots[static_cast<size_t>(slot)].handle;
+}
+
+const Item& ItemStore::at(int id) const {
+    const Item *item = find(id);
+    if (!item) throw std::out_of_range("No item with id " + std::to_string(id));
+    return *item;
+}
+
+// -----------------------------
+// Mutation
+// -----------------------------
+Item* ItemStore::insert(Item item) {
+    const int id = item.getId();
+    if (id < 0 || contains(id)) return nullptr;
+    maxId = std::max(maxId, id);
+
+    if (dense) {
+        size_t key = static_cast<size_t>(id);
+        if (!fitsDense(slots.size() + 1)) {
+            switchToSparse();
+        } else if (key >= direct.size()) {
+            direct.resize(std::max(key + 1, direct.size() * 2), EMPTY);
+        }
+    }
+
+    const ItemHandle handle = slab.create(std::move(item));
+    const int32_t slot = static_cast<int32_t>(slots.size());
+    if (dense) direct[static_cast<size_t>(id)] = slot;
+    else tableInsert(id, slot);
+    Item *stored = &slab.at(handle);
+    slots.push_back({stored, handle});
+    return stored;
+}
+
+bool ItemStore::erase(int id) {
+    int32_t slot = slotOf(id);
+    if (slot == EMPTY) return false;
+
+    if (dense) direct[static_cast<size_t>(id)] = EMPTY;
+    else tableErase(id);
+
+    // Keep slots contiguous: move the last entry into the hole (the
+    // items themselves stay where they are)
+    const size_t hole = static_cast<size_t>(slot);
+    slab.destroy(slots[hole].handle);
+    if (hole + 1 != slots.size()) {
+        slots[hole] = slots.back();
+        setSlot(slots[hole].item->getId(), slot);
+    }
+    slots.pop_back();
+    return true;
+}
+
+void ItemStore::clear() {
+    slab.clear();
+    slots.clear();
+    direct.clear();
+    table.clear();
+    dense = true;
+    maxId = -1;
+}
+
+void ItemStore::reserve(size_t count) {
+    slab.reserve(count);
+    slots.reserve(count);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+//Included file
+#include "ItemSlab.h"
+#include "Item.h"
+
+//Needed libraries
+#include <iterator>
+#include <cstdint>
+#include <vector>
+
+// Primary ID -> Item store for the inventory.
+//
+// Items are allocated in an ItemSlab and never move, so a pointer or
+// ItemHandle to an item stays valid until that item is erased. `slots`
+// is a contiguous array of (pointer, handle) pairs in row order (erase
+// swaps the last entry into the hole): scans and lookups follow the
+// pointer straight to the item without going through the slab's chunk
+// table, and slot N always matches row N of the inventory's HotColumns.
+// Lookups go through one of two indexes, picked automatically:
+//   - dense mode: `direct[id]` holds the slot, used while IDs stay compact
+//   - sparse mode: open-addressing table with linear probing
+class ItemStore {
+private:
+    struct Bucket {
+        int id;
+        int32_t slot;   // EMPTY when unused
+    };
+
+    struct Slot {
+        Item *item;          // Cached slab.at(handle): the hot path
+        ItemHandle handle;   // For erase and handleOf
+    };
+
+    static constexpr int32_t EMPTY = -1;
+    static constexpr size_t DENSE_SLACK = 1024;   // IDs below this are always direct-indexed
+    static constexpr size_t DENSE_FACTOR = 4;     // ...and up to 4x the item count beyond that
+
+    ItemSlab slab;
+    std::vector<Slot> slots;
+    std::vector<int32_t> direct;   // Dense mode: ID -> slot
+    std::vector<Bucket> table;     // Sparse mode: power-of-two open-addressing table
+    bool dense = true;
+    int maxId = -1;                // Largest ID ever inserted (drives the mode choice)
+
+    bool fitsDense(size_t count) const;
+
+    size_t bucketOf(int id) const;
+    void setSlot(int id, int32_t slot);
+    void tableInsert(int id, int32_t slot);
+    void tableErase(int id);
+    void growTable();
+    void switchToSparse();
+    void switchToDense();
+
+public:
+    // Walks items in slot order
+    class const_iterator {
+    private:
+        std::vector<Slot>::const_iterator pos;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Item*;
+        using reference = const Item&;
+
+        explicit const_iterator(std::vector<Slot>::const_iterator p) : pos(p) {}
+        reference operator*() const { return *pos->item; }
+        pointer operator->() const { return pos->item; }
+        const_iterator& operator++() { ++pos; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++pos; return old; }
+        bool operator==(const const_iterator &o) const { return pos == o.pos; }
+        bool operator!=(const const_iterator &o) const { return pos != o.pos; }
+    };
+
+    static constexpr int32_t NO_SLOT = EMPTY;
+    int32_t slotOf(int id) const;                         // NO_SLOT if not found
+    const Item& atSlot(size_t slot) const { return *slots[slot].item; }
+
+    // Handles survive rehashing, mode switches and other items' erasure;
+    // resolve() returns nullptr once the item itself is erased
+    ItemHandle handleOf(int id) const;                    // invalid handle if not found
+    const Item* resolve(ItemHandle handle) const { return slab.get(handle); }
+    SlabStats slabStats() const { return slab.stats(); }
+
+    Item* find(int id);
+    const Item* find(int id) const;
+    const Item& at(int id) const;              // throws std::out_of_range
+    bool contains(int id) const { return slotOf(id) != EMPTY; }
+
+    Item* insert(Item item);                   // Sink; returns the stored item, nullptr if duplicate
+    bool erase(int id);                        // returns false if not found
+    void clear();
+    void reserve(size_t count);
+
+    size_t size() const { return slots.size(); }
+    bool empty() const { return slots.empty(); }
+    bool isDense() const { return dense; }
+
+    const_iterator begin() const { return const_iterator(slots.begin()); }
+    const_iterator end() const { return const_iterator(slots.end()); }
+};
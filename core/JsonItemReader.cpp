@@ -0,0 +1,370 @@
+//Included files
+#include "JsonItemReader.h"
+
+//Needed libraries
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+// ─────────────────────────────────────────────
+// ItemFields
+// ─────────────────────────────────────────────
+Item ItemFields::toItem() const {
+    if (!invalid.empty()) throw std::invalid_argument(invalid);
+    return Item(id, std::string(name), quantity, location, price, currency, unit, category, std::string(sku));
+}
+
+// ─────────────────────────────────────────────
+// Reader
+// ─────────────────────────────────────────────
+JsonItemReader::JsonItemReader(std::string_view text, size_t base)
+    : text(text), base(base) {}
+
+JsonItemReader JsonItemReader::slice(std::string_view objects, size_t base) {
+    JsonItemReader reader(objects, base);
+    reader.sliced = true;
+    reader.state = State::First;
+    return reader;
+}
+
+std::string JsonItemReader::error() const {
+    return "byte " + std::to_string(errorOffset()) + ": " + message;
+}
+
+bool JsonItemReader::fail(size_t at, std::string what) {
+    if (message.empty()) {   // Keep the first error
+        errorPos = at;
+        message = std::move(what);
+    }
+    state = State::Done;
+    return false;
+}
+
+void JsonItemReader::skipSpace() {
+    while (pos < text.size()) {
+        const char c = text[pos];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') break;
+        ++pos;
+    }
+}
+
+bool JsonItemReader::expect(char c) {
+    skipSpace();
+    if (pos >= text.size() || text[pos] != c) return fail(pos, std::string("expected '") + c + "'");
+    ++pos;
+    return true;
+}
+
+bool JsonItemReader::next(ItemFields &out) {
+    if (state == State::Done) return false;
+
+    if (state == State::Start) {
+        skipSpace();
+        if (pos == text.size()) {   // Empty file: no items yet
+            state = State::Done;
+            return false;
+        }
+        if (text[pos] == '{') {
+            bareObject = true;
+        } else if (text[pos] == '[') {
+            ++pos;
+            skipSpace();
+            if (pos < text.size() && text[pos] == ']') {
+                ++pos;
+                return finish();
+            }
+        } else {
+            return fail(pos, "expected '[' or '{'");
+        }
+        state = State::First;
+    } else if (state == State::Rest) {
+        if (bareObject) return finish();
+        skipSpace();
+        if (sliced && pos == text.size()) {
+            state = State::Done;
+            return false;
+        }
+        if (!sliced && pos < text.size() && text[pos] == ']') {
+            ++pos;
+            return finish();
+        }
+        if (pos >= text.size() || text[pos] != ',') return fail(pos, "expected ',' or ']'");
+        ++pos;
+    }
+
+    if (!readObject(out)) return false;
+    state = State::Rest;
+    return true;
+}
+
+bool JsonItemReader::finish() {
+    skipSpace();
+    if (pos < text.size()) return fail(pos, "unexpected data after the document");
+    state = State::Done;
+    return false;
+}
+
+// ─────────────────────────────────────────────
+// Objects
+// ─────────────────────────────────────────────
+bool JsonItemReader::readObject(ItemFields &out) {
+    skipSpace();
+    out = ItemFields{};
+    out.offset = base + pos;
+    if (!expect('{')) return false;
+
+    skipSpace();
+    if (pos < text.size() && text[pos] == '}') {
+        ++pos;
+        return true;
+    }
+
+    auto textField = [&](std::string_view &dst, Field field, std::string_view key) {
+        skipSpace();
+        if (pos >= text.size() || text[pos] != '"')
+            return fail(pos, "\"" + std::string(key) + "\" must be a string");
+        return readString(dst, scratch[field]);
+    };
+
+    for (;;) {
+        skipSpace();
+        if (pos >= text.size() || text[pos] != '"') return fail(pos, "expected a key");
+        std::string_view key;
+        if (!readString(key, keyScratch) || !expect(':')) return false;
+
+        bool ok;
+        if (key == "id")              ok = readInt(out.id, key, out.invalid);
+        else if (key == "quantity")   ok = readInt(out.quantity, key, out.invalid);
+        else if (key == "price")      ok = readDouble(out.price, key);
+        else if (key == "name")       ok = textField(out.name, Name, key);
+        else if (key == "location")   ok = textField(out.location, Location, key);
+        else if (key == "sku")        ok = textField(out.sku, Sku, key);
+        else if (key == "currency")   ok = textField(out.currency, Currency, key);
+        else if (key == "unit")       ok = textField(out.unit, Unit, key);
+        else if (key == "category")   ok = textField(out.category, Category, key);
+        else                          ok = skipValue();
+        if (!ok) return false;
+
+        skipSpace();
+        if (pos < text.size() && text[pos] == ',') {
+            ++pos;
+            continue;
+        }
+        if (pos < text.size() && text[pos] == '}') {
+            ++pos;
+            return true;
+        }
+        return fail(pos, "expected ',' or '}'");
+    }
+}
+
+// ─────────────────────────────────────────────
+// Strings
+// ─────────────────────────────────────────────
+
+// Called on the opening quote. Values without escapes are returned as a
+// view of the document; the first backslash switches to `buffer`.
+bool JsonItemReader::readString(std::string_view &out, std::string &buffer) {
+    const size_t open = pos++;
+    const size_t start = pos;
+
+    while (pos < text.size()) {
+        const unsigned char c = static_cast<unsigned char>(text[pos]);
+        if (c == '"') {
+            out = text.substr(start, pos - start);
+            ++pos;
+            return true;
+        }
+        if (c == '\\') break;
+        if (c < 0x20) return fail(pos, "control character in string");
+        ++pos;
+    }
+    if (pos >= text.size()) return fail(open, "unterminated string");
+
+    buffer.assign(text.substr(start, pos - start));
+    while (pos < text.size()) {
+        const char c = text[pos];
+        if (c == '"') {
+            out = buffer;
+            ++pos;
+            return true;
+        }
+        if (static_cast<unsigned char>(c) < 0x20) return fail(pos, "control character in string");
+        if (c != '\\') {
+            buffer += c;
+            ++pos;
+            continue;
+        }
+
+        if (pos + 1 >= text.size()) break;
+        const size_t escape = pos;
+        pos += 2;
+        switch (text[escape + 1]) {
+            case '"':  buffer += '"';  break;
+            case '\\': buffer += '\\'; break;
+            case '/':  buffer += '/';  break;
+            case 'b':  buffer += '\b'; break;
+            case 'f':  buffer += '\f'; break;
+            case 'n':  buffer += '\n'; break;
+            case 'r':  buffer += '\r'; break;
+            case 't':  buffer += '\t'; break;
+            case 'u':
+                if (!readUnicode(buffer)) return false;
+                break;
+            default:
+                return fail(escape, "invalid escape");
+        }
+    }
+    return fail(open, "unterminated string");
+}
+
+// Called just past "\u"; appends the code point as UTF-8
+bool JsonItemReader::readUnicode(std::string &buffer) {
+    auto hex4 = [&](uint32_t &cp) {
+        if (pos + 4 > text.size()) return false;
+        cp = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            const char c = text[pos + i];
+            cp <<= 4;
+            if (c >= '0' && c <= '9') cp |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') cp |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') cp |= static_cast<uint32_t>(c - 'A' + 10);
+            else return false;
+        }
+        pos += 4;
+        return true;
+    };
+
+    const size_t escape = pos - 2;
+    uint32_t cp;
+    if (!hex4(cp)) return fail(escape, "invalid \\u escape");
+
+    if (cp >= 0xDC00 && cp <= 0xDFFF) return fail(escape, "unpaired surrogate in \\u escape");
+    if (cp >= 0xD800 && cp <= 0xDBFF) {
+        uint32_t low;
+        if (pos + 2 > text.size() || text[pos] != '\\' || text[pos + 1] != 'u')
+            return fail(escape, "unpaired surrogate in \\u escape");
+        pos += 2;
+        if (!hex4(low) || low < 0xDC00 || low > 0xDFFF)
+            return fail(escape, "unpaired surrogate in \\u escape");
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    if (cp < 0x80) {
+        buffer += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        buffer += static_cast<char>(0xC0 | (cp >> 6));
+        buffer += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        buffer += static_cast<char>(0xE0 | (cp >> 12));
+        buffer += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        buffer += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        buffer += static_cast<char>(0xF0 | (cp >> 18));
+        buffer += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        buffer += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        buffer += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────
+// Numbers and other values
+// ─────────────────────────────────────────────
+bool JsonItemReader::readNumber(std::string_view &out) {
+    skipSpace();
+    const size_t start = pos;
+    while (pos < text.size()) {
+        const char c = text[pos];
+        if ((c < '0' || c > '9') && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') break;
+        ++pos;
+    }
+    if (pos == start) return fail(pos, "expected a number");
+    out = text.substr(start, pos - start);
+    return true;
+}
+
+// Any JSON number is accepted syntactically. One with an integral value
+// (5, 5.0, 1e3) is converted; a fraction or a value outside int range
+// marks the record invalid, so the load names that record instead of
+// failing the document with a syntax error.
+bool JsonItemReader::readInt(int &out, std::string_view key, std::string &invalid) {
+    std::string_view digits;
+    if (!readNumber(digits)) return false;
+    const size_t start = pos - digits.size();
+    const char *first = digits.data();
+    const char *last = first + digits.size();
+
+    const auto exact = std::from_chars(first, last, out);
+    if (exact.ec == std::errc() && exact.ptr == last) return true;
+
+    double value = 0.0;
+    const auto real = std::from_chars(first, last, value);
+    if (real.ptr != last || (real.ec != std::errc() && real.ec != std::errc::result_out_of_range))
+        return fail(start, "\"" + std::string(key) + "\" must be a number");
+
+    const bool inRange = real.ec == std::errc() && value >= INT_MIN && value <= INT_MAX;
+    if (inRange && value == std::floor(value)) {
+        out = static_cast<int>(value);
+        return true;
+    }
+    if (invalid.empty())
+        invalid = "\"" + std::string(key) + (inRange ? "\" must be an integer" : "\" is out of range");
+    return true;
+}
+
+bool JsonItemReader::readDouble(double &out, std::string_view key) {
+    std::string_view digits;
+    if (!readNumber(digits)) return false;
+    const size_t start = pos - digits.size();
+
+    const auto [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), out);
+    if (ec != std::errc() || end != digits.data() + digits.size())
+        return fail(start, "\"" + std::string(key) + "\" must be a number");
+    return true;
+}
+
+// Skips a value under a key the loader does not use. Nested containers
+// are only checked for balanced brackets.
+bool JsonItemReader::skipValue() {
+    skipSpace();
+    if (pos >= text.size()) return fail(pos, "expected a value");
+
+    const char c = text[pos];
+    std::string_view ignored;
+    if (c == '"') return readString(ignored, keyScratch);
+
+    if (c == '{' || c == '[') {
+        std::string closers;
+        while (pos < text.size()) {
+            const char d = text[pos];
+            if (d == '"') {
+                if (!readString(ignored, keyScratch)) return false;
+                continue;
+            }
+            if (d == '{') closers += '}';
+            else if (d == '[') closers += ']';
+            else if (d == '}' || d == ']') {
+                if (closers.back() != d) return fail(pos, std::string("unexpected '") + d + "'");
+                closers.pop_back();
+                if (closers.empty()) {
+                    ++pos;
+                    return true;
+                }
+            }
+            ++pos;
+        }
+        return fail(pos, "unterminated value");
+    }
+
+    for (std::string_view word : {std::string_view("true"), std::string_view("false"), std::string_view("null")}) {
+        if (text.substr(pos, word.size()) == word) {
+            pos += word.size();
+            return true;
+        }
+    }
+    return readNumber(ignored);
+}
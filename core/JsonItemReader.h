@@ -0,0 +1,85 @@
+#pragma once
+
+//Included files
+#include "Item.h"
+
+//Needed libraries
+#include <string_view>
+#include <cstddef>
+#include <string>
+
+// One item object as read from JSON. Text fields view the document, or
+// the reader's scratch when the value held escapes, so they are only
+// valid until the reader's next call. Absent fields keep these defaults.
+struct ItemFields {
+    int id = 0;
+    int quantity = 0;
+    double price = 0.0;
+    std::string_view name;
+    std::string_view location;
+    std::string_view sku;
+    std::string_view currency = "EGP";
+    std::string_view unit = "pcs";
+    std::string_view category = "general";
+    size_t offset = 0;   // Byte offset of the object's '{'
+    std::string invalid;   // Set when a well-formed value does not fit (e.g. "quantity": 2.5)
+
+    Item toItem() const;   // Throws std::invalid_argument if the item does not validate
+};
+
+// Single-pass pull parser for the inventory file: a top-level array of
+// item objects, or one bare object. Works on a string_view (usually a
+// mapped file), never copies the document and only allocates for string
+// values that contain escapes. \uXXXX escapes, surrogate pairs included,
+// are decoded to UTF-8. Unknown keys are skipped whatever their value.
+//
+//   JsonItemReader reader(text);
+//   ItemFields f;
+//   while (reader.next(f)) ...;
+//   if (reader.failed()) ... reader.error() ...
+class JsonItemReader {
+public:
+    // `base` is added to reported offsets when `text` is a slice of a larger file
+    explicit JsonItemReader(std::string_view text, size_t base = 0);
+
+    // Reader for a run of comma-separated objects cut out of a larger
+    // array (see JsonPrescan); `base` is the run's offset in the file
+    static JsonItemReader slice(std::string_view objects, size_t base);
+
+    // Reads the next item; false at the end of the document or on error
+    bool next(ItemFields &out);
+
+    bool failed() const { return !message.empty(); }
+    size_t errorOffset() const { return base + errorPos; }
+    std::string error() const;   // "byte N: <what went wrong>"
+
+private:
+    enum Field { Name, Location, Sku, Currency, Unit, Category, TEXT_FIELDS };
+
+    std::string_view text;
+    size_t base;
+    size_t pos = 0;
+
+    enum class State { Start, First, Rest, Done } state = State::Start;
+    bool bareObject = false;   // Document is one object, not an array
+    bool sliced = false;       // No brackets: objects run to the end of `text`
+
+    std::string scratch[TEXT_FIELDS];   // Unescaped values, reused per item
+    std::string keyScratch;
+
+    std::string message;
+    size_t errorPos = 0;
+
+    bool fail(size_t at, std::string what);   // Records the first error; always false
+    bool finish();                            // Only whitespace may follow the document
+    void skipSpace();
+    bool expect(char c);
+
+    bool readObject(ItemFields &out);
+    bool readString(std::string_view &out, std::string &buffer);
+    bool readUnicode(std::string &buffer);
+    bool readNumber(std::string_view &out);
+    bool readInt(int &out, std::string_view key, std::string &invalid);
+    bool readDouble(double &out, std::string_view key);
+    bool skipValue();
+};
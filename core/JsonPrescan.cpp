@@ -0,0 +1,161 @@
+//Included files
+#include "JsonPrescan.h"
+
+//Needed libraries
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WMS_PRESCAN_SSE2 1
+#endif
+
+// ─────────────────────────────────────────────
+// Classification
+// ─────────────────────────────────────────────
+namespace {
+    bool isStructural(char c) {
+        return c == '"' || c == '\\' || c == '{' || c == '}' || c == '[' || c == ']';
+    }
+
+    bool isSpace(char c) {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    // Bit i set if block[i] is structural
+    uint32_t structuralMask(const char *block) {
+#ifdef WMS_PRESCAN_SSE2
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        __m128i hits = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\')));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('{')));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('}')));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('[')));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(']')));
+        return static_cast<uint32_t>(_mm_movemask_epi8(hits));
+#else
+        uint32_t mask = 0;
+        for (unsigned i = 0; i < 16; ++i)
+            if (isStructural(block[i])) mask |= 1u << i;
+        return mask;
+#endif
+    }
+
+    // Index of the lowest set bit; mask must be non-zero
+    inline unsigned lowestBit(uint32_t mask) {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+        unsigned bit = 0;
+        while (!(mask & (1u << bit))) ++bit;
+        return bit;
+#endif
+    }
+
+    bool isBlank(std::string_view gap) {
+        for (char c : gap)
+            if (!isSpace(c)) return false;
+        return true;
+    }
+
+    // Whitespace, exactly one ',' and whitespace
+    bool isSeparator(std::string_view gap) {
+        size_t commas = 0;
+        for (char c : gap) {
+            if (c == ',') ++commas;
+            else if (!isSpace(c)) return false;
+        }
+        return commas == 1;
+    }
+}
+
+// ─────────────────────────────────────────────
+// Split
+// ─────────────────────────────────────────────
+JsonPrescan::Split JsonPrescan::splitArray(std::string_view doc, size_t parts) {
+    Split split;
+    const size_t n = doc.size();
+    if (parts == 0) parts = 1;
+
+    size_t open = 0;
+    while (open < n && isSpace(doc[open])) ++open;
+    if (open >= n || doc[open] != '[') return split;
+
+    bool inString = false;
+    bool bad = false;
+    size_t skipTo = 0;            // Byte after a backslash is escaped
+    size_t depth = 1;             // Inside the array
+    size_t arrayEnd = 0;          // Offset of the closing ']', 0 until seen
+    size_t lastClose = 0;         // One past the last top-level '}'
+    size_t sliceStart = 0;
+    bool inSlice = false;
+    size_t nextTarget = 0;
+
+    auto visit = [&](size_t pos) {
+        if (pos < skipTo) return;
+        const char c = doc[pos];
+        if (inString) {
+            if (c == '\\') skipTo = pos + 2;
+            else if (c == '"') inString = false;
+            return;
+        }
+        if (arrayEnd) {   // Nothing structural may follow the array
+            bad = true;
+            return;
+        }
+
+        switch (c) {
+            case '"':
+                inString = true;
+                break;
+            case '{':
+                if (depth == 1) {
+                    ++split.objects;
+                    if (!inSlice) {
+                        if (!isBlank(doc.substr(open + 1, pos - open - 1))) bad = true;
+                        sliceStart = pos;
+                        inSlice = true;
+                        nextTarget = n / parts;
+                    } else if (pos >= nextTarget) {
+                        if (!isSeparator(doc.substr(lastClose, pos - lastClose))) bad = true;
+                        split.slices.push_back({sliceStart, lastClose});
+                        sliceStart = pos;
+                        nextTarget = n * (split.slices.size() + 1) / parts;
+                    }
+                }
+                ++depth;
+                break;
+            case '[':
+                ++depth;
+                break;
+            case '}':
+            case ']':
+                if (depth == 0) {
+                    bad = true;
+                    break;
+                }
+                --depth;
+                if (depth == 1 && c == '}') lastClose = pos + 1;
+                if (depth == 0) arrayEnd = pos;   // The '[' at `open` is the only depth-0 bracket
+                break;
+            default:   // Backslash outside a string
+                bad = true;
+                break;
+        }
+    };
+
+    size_t i = open + 1;
+    for (; i + 16 <= n && !bad; i += 16) {
+        for (uint32_t mask = structuralMask(doc.data() + i); mask; mask &= mask - 1)
+            visit(i + lowestBit(mask));
+    }
+    for (; i < n && !bad; ++i)
+        if (isStructural(doc[i])) visit(i);
+
+    if (bad || inString || !arrayEnd || !isBlank(doc.substr(arrayEnd + 1))) return Split{};
+
+    // Only whitespace between the last object (or '[') and ']'
+    const size_t tail = inSlice ? lastClose : open + 1;
+    if (!isBlank(doc.substr(tail, arrayEnd - tail))) return Split{};
+    if (inSlice) split.slices.push_back({sliceStart, lastClose});
+    return split;
+}
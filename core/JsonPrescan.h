@@ -0,0 +1,31 @@
+#pragma once
+
+//Needed libraries
+#include <string_view>
+#include <cstddef>
+#include <vector>
+
+// Structural pre-scan of an inventory file (a top-level array of
+// objects) that cuts it into independently parseable slices.
+//
+// One pass classifies 16 bytes at a time (SSE2 where available) and only
+// visits quotes, backslashes and brackets, tracking string state and
+// nesting depth. Each slice runs from an object's '{' to the '}' that
+// closes the last object in it, so it can be read with
+// JsonItemReader::slice. Only the separators between slices are checked
+// here; everything inside a slice is left to its reader.
+class JsonPrescan {
+public:
+    struct Slice {
+        size_t begin;   // Offset of the first object's '{'
+        size_t end;     // One past the last object's '}'
+    };
+
+    struct Split {
+        std::vector<Slice> slices;   // Empty if the document could not be split
+        size_t objects = 0;          // Top-level objects seen
+    };
+
+    // Aims for `parts` slices of similar size (fewer if the objects run out)
+    static Split splitArray(std::string_view doc, size_t parts);
+};
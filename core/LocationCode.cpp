@@ -0,0 +1,105 @@
+//Included files
+#include "LocationCode.h"
+
+//Needed libraries
+#include <cstdio>
+
+// ─────────────────────────────────────────────
+// Segment encoding
+// ─────────────────────────────────────────────
+namespace {
+    // Base-37 digit: 0 = padding, 1-10 = '0'-'9', 11-36 = 'A'-'Z'.
+    // Padding sorts first, so "B" < "B1" < "BA".
+    int zoneDigit(char c) {
+        if (c >= '0' && c <= '9') return 1 + (c - '0');
+        if (c >= 'A' && c <= 'Z') return 11 + (c - 'A');
+        if (c >= 'a' && c <= 'z') return 11 + (c - 'a');
+        return -1;
+    }
+
+    bool parseZone(std::string_view text, uint16_t &out) {
+        if (text.empty() || text.size() > 3) return false;
+        unsigned value = 0;
+        for (size_t i = 0; i < 3; ++i) {
+            int d = 0;
+            if (i < text.size()) {
+                d = zoneDigit(text[i]);
+                if (d < 0) return false;
+            }
+            value = value * 37 + static_cast<unsigned>(d);
+        }
+        out = static_cast<uint16_t>(value);   // 37^3 - 1 fits in 16 bits
+        return true;
+    }
+
+    bool parseNumber(std::string_view text, uint16_t &out) {
+        if (text.empty() || text.size() > 5) return false;
+        unsigned value = 0;
+        for (char c : text) {
+            if (c < '0' || c > '9') return false;
+            value = value * 10 + static_cast<unsigned>(c - '0');
+        }
+        if (value > 0xFFFF) return false;
+        out = static_cast<uint16_t>(value);
+        return true;
+    }
+}
+
+// ─────────────────────────────────────────────
+// Parsing
+// ─────────────────────────────────────────────
+std::optional<LocationCode> LocationCode::parsePrefix(std::string_view text) {
+    LocationCode code;
+    size_t start = 0;
+
+    while (true) {
+        if (code.levels == LEVELS) return std::nullopt;   // Too many segments
+
+        size_t dash = text.find('-', start);
+        std::string_view part = text.substr(start, dash == std::string_view::npos ? std::string_view::npos : dash - start);
+
+        uint16_t value;
+        bool ok = code.levels == 0 ? parseZone(part, value) : parseNumber(part, value);
+        if (!ok) return std::nullopt;
+
+        code.packed |= static_cast<uint64_t>(value) << (16 * (LEVELS - 1 - code.levels));
+        ++code.levels;
+
+        if (dash == std::string_view::npos) return code;
+        start = dash + 1;
+    }
+}
+
+std::optional<LocationCode> LocationCode::parse(std::string_view text) {
+    auto code = parsePrefix(text);
+    if (!code || code->levels != LEVELS) return std::nullopt;
+    return code;
+}
+
+// ─────────────────────────────────────────────
+// Formatting
+// ─────────────────────────────────────────────
+std::string LocationCode::segmentText(int level, uint16_t value) {
+    if (level > 0) {
+        char buf[8];
+        std::snprintf(buf, sizeof(buf), "%02u", static_cast<unsigned>(value));
+        return buf;
+    }
+
+    static const char alphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    std::string zone;
+    unsigned digits[3] = {value / (37u * 37u), (value / 37u) % 37u, value % 37u};
+    for (unsigned d : digits) {
+        if (d != 0) zone += alphabet[d - 1];
+    }
+    return zone;
+}
+
+std::string LocationCode::toString() const {
+    std::string out;
+    for (int level = 0; level < levels; ++level) {
+        if (level > 0) out += '-';
+        out += segmentText(level, segment(level));
+    }
+    return out;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+//Needed libraries
+#include <string_view>
+#include <optional>
+#include <cstdint>
+#include <string>
+
+// Parsed ZONE-AISLE-RACK-BIN warehouse location, e.g. "B-07-03-12".
+//
+//  - ZONE:              1-3 letters/digits (case-insensitive)
+//  - AISLE, RACK, BIN:  decimal numbers 0-65535
+//
+// The code packs into one 64-bit key, 16 bits per level with the zone
+// first, so keys sort zone, then aisle, then rack, then bin. A prefix
+// ("B", "B-07", "B-07-03") parses to the same layout with fewer levels set.
+class LocationCode {
+public:
+    static constexpr int LEVELS = 4;
+
+    static std::optional<LocationCode> parse(std::string_view text);         // Exactly 4 segments
+    static std::optional<LocationCode> parsePrefix(std::string_view text);   // 1-4 segments
+
+    uint64_t key() const { return packed; }
+    int depth() const { return levels; }
+    uint16_t segment(int level) const { return static_cast<uint16_t>(packed >> (16 * (LEVELS - 1 - level))); }
+
+    // True if `code` lies under this prefix (a full code contains only itself)
+    bool contains(const LocationCode &code) const {
+        if (levels == 0) return true;
+        const int shift = 16 * (LEVELS - levels);
+        return code.levels >= levels && (code.packed >> shift) == (packed >> shift);
+    }
+
+    std::string toString() const;   // Canonical form: upper-case zone, 2+ digit numbers
+
+    static std::string segmentText(int level, uint16_t value);
+
+private:
+    uint64_t packed = 0;
+    int levels = 0;
+};
@@ -0,0 +1,81 @@
+//Included files
+#include "LocationTrie.h"
+
+// ─────────────────────────────────────────────
+// Updates
+// ─────────────────────────────────────────────
+void LocationTrie::insert(const LocationCode &code, int id) {
+    Node *path[LocationCode::LEVELS + 1] = {&root};
+    for (int level = 0; level < LocationCode::LEVELS; ++level) {
+        auto &child = path[level]->children[code.segment(level)];
+        if (!child) child = std::make_unique<Node>();
+        path[level + 1] = child.get();
+    }
+
+    if (!path[LocationCode::LEVELS]->ids.insert(id).second) return;   // Already indexed
+    for (Node *node : path) ++node->count;
+}
+
+void LocationTrie::erase(const LocationCode &code, int id) {
+    Node *path[LocationCode::LEVELS + 1] = {&root};
+    for (int level = 0; level < LocationCode::LEVELS; ++level) {
+        auto it = path[level]->children.find(code.segment(level));
+        if (it == path[level]->children.end()) return;
+        path[level + 1] = it->second.get();
+    }
+
+    if (path[LocationCode::LEVELS]->ids.erase(id) == 0) return;
+
+    // Decrement counts bottom-up and prune subtrees that became empty
+    for (int level = LocationCode::LEVELS; level >= 0; --level) {
+        --path[level]->count;
+        if (level > 0 && path[level]->count == 0)
+            path[level - 1]->children.erase(code.segment(level - 1));
+    }
+}
+
+void LocationTrie::clear() {
+    root.children.clear();
+    root.ids.clear();
+    root.count = 0;
+}
+
+// ─────────────────────────────────────────────
+// Lookups
+// ─────────────────────────────────────────────
+const LocationTrie::Node* LocationTrie::find(const LocationCode &prefix) const {
+    const Node *node = &root;
+    for (int level = 0; level < prefix.depth(); ++level) {
+        auto it = node->children.find(prefix.segment(level));
+        if (it == node->children.end()) return nullptr;
+        node = it->second.get();
+    }
+    return node;
+}
+
+size_t LocationTrie::count(const LocationCode &prefix) const {
+    const Node *node = find(prefix);
+    return node ? node->count : 0;
+}
+
+bool LocationTrie::walk(const Node &node, const std::function<bool(int)> &visit) {
+    for (int id : node.ids) {
+        if (!visit(id)) return false;
+    }
+    for (const auto &[segment, child] : node.children) {
+        if (!walk(*child, visit)) return false;
+    }
+    return true;
+}
+
+void LocationTrie::visit(const LocationCode &prefix, const std::function<bool(int)> &visit) const {
+    if (const Node *node = find(prefix)) walk(*node, visit);
+}
+
+std::map<uint16_t, size_t> LocationTrie::children(const LocationCode &prefix) const {
+    std::map<uint16_t, size_t> out;
+    const Node *node = find(prefix);
+    if (!node) return out;
+    for (const auto &[segment, child] : node->children) out.emplace(segment, child->count);
+    return out;
+}
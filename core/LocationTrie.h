@@ -0,0 +1,44 @@
+#pragma once
+
+//Included files
+#include "LocationCode.h"
+
+//Needed libraries
+#include <functional>
+#include <cstdint>
+#include <memory>
+#include <map>
+#include <set>
+
+// Four-level trie over LocationCode segments (zone -> aisle -> rack -> bin).
+// Every node keeps the number of items below it, so a prefix lookup
+// descends at most four levels and then walks only the matching subtree:
+// O(depth + result) at any level of the hierarchy. Children are ordered,
+// so a walk yields items in location order, then by ID within a bin.
+class LocationTrie {
+private:
+    struct Node {
+        std::map<uint16_t, std::unique_ptr<Node>> children;
+        std::set<int> ids;   // Bin level only
+        size_t count = 0;    // Items in this subtree
+    };
+
+    Node root;
+
+    const Node* find(const LocationCode &prefix) const;
+    static bool walk(const Node &node, const std::function<bool(int)> &visit);
+
+public:
+    void insert(const LocationCode &code, int id);
+    void erase(const LocationCode &code, int id);
+    void clear();
+
+    size_t count(const LocationCode &prefix) const;   // O(depth)
+    size_t size() const { return root.count; }
+
+    // Visits IDs under `prefix` in location order; return false to stop
+    void visit(const LocationCode &prefix, const std::function<bool(int)> &visit) const;
+
+    // Child segments of `prefix` with their item counts (for drill-down)
+    std::map<uint16_t, size_t> children(const LocationCode &prefix) const;
+};
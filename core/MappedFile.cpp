@@ -0,0 +1,104 @@
+//Included files
+#include "MappedFile.h"
+
+//Needed libraries
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// ─────────────────────────────────────────────
+// Open / close
+// ─────────────────────────────────────────────
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+bool MappedFile::open(const std::string &path, std::string &err) {
+    close();
+
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) {
+        err = "Failed to open " + path;
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(f, &size)) {
+        CloseHandle(f);
+        err = "Failed to stat " + path;
+        return false;
+    }
+
+    file = f;
+    opened = true;
+    length = static_cast<size_t>(size.QuadPart);
+    if (length == 0) return true;
+
+    mapping = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!data) {
+        close();
+        err = "Failed to map " + path;
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+    data = nullptr;
+    mapping = nullptr;
+    file = nullptr;
+    length = 0;
+    opened = false;
+}
+#else
+bool MappedFile::open(const std::string &path, std::string &err) {
+    close();
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        err = "Failed to open " + path;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        err = "Failed to stat " + path;
+        return false;
+    }
+
+    opened = true;
+    length = static_cast<size_t>(st.st_size);
+    if (length > 0) {
+        void *p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            close();
+            err = "Failed to map " + path;
+            return false;
+        }
+        madvise(p, length, MADV_SEQUENTIAL);   // Loading walks the file front to back
+        data = static_cast<const char*>(p);
+    }
+    ::close(fd);   // The mapping keeps the file alive
+    return true;
+}
+
+void MappedFile::close() {
+    if (data) munmap(const_cast<char*>(data), length);
+    data = nullptr;
+    length = 0;
+    opened = false;
+}
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+
+//Needed libraries
+#include <string_view>
+#include <cstddef>
+#include <string>
+
+// Read-only memory map of a whole file. The bytes stay valid until the
+// map is closed or destroyed; pages are read in by the OS on first touch.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile& operator=(const MappedFile &) = delete;
+
+    bool open(const std::string &path, std::string &err);   // false (with err) if missing or unmappable
+    void close();
+
+    std::string_view bytes() const { return {data, length}; }
+    bool isOpen() const { return opened; }
+
+private:
+    const char *data = nullptr;
+    size_t length = 0;
+    bool opened = false;   // Empty files have no mapping but are still open
+
+#ifdef _WIN32
+    void *file = nullptr;
+    void *mapping = nullptr;
+#endif
+};
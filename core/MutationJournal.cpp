@@ -0,0 +1,218 @@
+//Included files
+#include "MutationJournal.h"
+#include "safetyparse.hpp"
+
+//Needed libraries
+#include <stdexcept>
+
+// ─────────────────────────────────────────────
+// Constructor
+// ─────────────────────────────────────────────
+MutationJournal::MutationJournal(const std::string &snapshotPath) : log(snapshotPath + ".wal") {}
+
+MutationJournal::~MutationJournal() {
+    stopFlusher();   // Writes whatever is still staged
+}
+
+// ─────────────────────────────────────────────
+// Durability
+// ─────────────────────────────────────────────
+void MutationJournal::setDurability(Durability m, std::chrono::microseconds window, size_t windowBytes) {
+    stopFlusher();
+
+    std::lock_guard<std::mutex> held(lock);
+    mode = m;
+    groupWindow = window;
+    groupBytes = windowBytes;
+    if (mode == Durability::Group) {
+        stopping = false;
+        flusher = std::thread(&MutationJournal::flusherLoop, this);
+    }
+}
+
+Durability MutationJournal::durability() const {
+    std::lock_guard<std::mutex> held(lock);
+    return mode;
+}
+
+void MutationJournal::stopFlusher() {
+    {
+        std::lock_guard<std::mutex> held(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (flusher.joinable()) flusher.join();
+}
+
+// ─────────────────────────────────────────────
+// Staging
+// ─────────────────────────────────────────────
+void MutationJournal::stage(const std::string &record) {
+    std::lock_guard<std::mutex> held(lock);
+    pending += record;
+    pending += '\n';
+    ++staged;
+    ++stagedSeq;
+}
+
+void MutationJournal::recordAdd(const Item &item) {
+    stage("A " + item.toJSON());
+}
+
+void MutationJournal::recordRemove(int id) {
+    stage("R " + std::to_string(id));
+}
+
+void MutationJournal::recordQuantity(int id, int quantity) {
+    stage("Q " + std::to_string(id) + " " + std::to_string(quantity));
+}
+
+size_t MutationJournal::size() const {
+    std::lock_guard<std::mutex> held(lock);
+    return records + staged;
+}
+
+bool MutationJournal::hasPending() const {
+    std::lock_guard<std::mutex> held(lock);
+    return staged != 0;
+}
+
+// ─────────────────────────────────────────────
+// Persistence
+// ─────────────────────────────────────────────
+// Writes everything staged as one append. Called with `held` locked; the
+// lock is released around the I/O so others can keep staging.
+std::optional<StorageError> MutationJournal::writeStaged(std::unique_lock<std::mutex> &held, bool sync) {
+    written.wait(held, [&] { return !writing; });
+    if (pending.empty()) return std::nullopt;
+
+    std::string batch;
+    batch.swap(pending);
+    const size_t count = staged;
+    const uint64_t last = stagedSeq;
+    staged = 0;
+    writing = true;
+
+    held.unlock();
+    auto err = log.append(batch, false, sync);
+    held.lock();
+
+    writing = false;
+    if (err) {
+        pending.insert(0, batch);   // Keep them staged (in order) for the caller to handle
+        staged += count;
+        failedSeq = last;
+        lastError = err->message;
+    } else {
+        records += count;
+        durableSeq = last;
+    }
+    written.notify_all();
+    return err;
+}
+
+std::optional<StorageError> MutationJournal::flush() {
+    std::unique_lock<std::mutex> held(lock);
+    if (mode != Durability::Group) return writeStaged(held, mode == Durability::Commit);
+
+    const uint64_t mine = stagedSeq;
+    if (durableSeq >= mine) return std::nullopt;
+
+    wake.notify_one();
+    written.wait(held, [&] { return durableSeq >= mine || failedSeq >= mine; });
+    if (durableSeq >= mine) return std::nullopt;
+    return StorageError(lastError);
+}
+
+void MutationJournal::flusherLoop() {
+    std::unique_lock<std::mutex> held(lock);
+    while (true) {
+        // Failed records are left to the committers; wait for new ones
+        wake.wait(held, [&] { return stopping || (!pending.empty() && stagedSeq > failedSeq); });
+        if (stopping) {
+            writeStaged(held, true);
+            return;
+        }
+
+        // Optionally hold the batch open so more commits can join it
+        if (groupWindow.count() > 0) {
+            const auto deadline = std::chrono::steady_clock::now() + groupWindow;
+            wake.wait_until(held, deadline, [&] { return stopping || pending.size() >= groupBytes; });
+        }
+        writeStaged(held, true);
+    }
+}
+
+std::optional<StorageError> MutationJournal::reset() {
+    std::unique_lock<std::mutex> held(lock);
+    written.wait(held, [&] { return !writing; });
+    if (auto err = log.clear(mode != Durability::None)) return err;
+
+    // The checkpoint covers everything staged so far
+    records = 0;
+    staged = 0;
+    pending.clear();
+    durableSeq = stagedSeq;
+    written.notify_all();
+    return std::nullopt;
+}
+
+// ─────────────────────────────────────────────
+// Replay
+// ─────────────────────────────────────────────
+size_t MutationJournal::replay(Inventory &inv, std::string &err) {
+    std::string readErr;
+    const auto data = log.readAll(readErr);   // No log yet: nothing to do
+    if (!data) return 0;
+
+    size_t applied = 0;
+    for (size_t pos = 0; pos < data->size();) {
+        const size_t end = data->find('\n', pos);
+        if (end == std::string::npos) {
+            // No terminator: the last append was cut short
+            err = "Torn journal record " + std::to_string(applied + 1);
+            break;
+        }
+        const std::string line = data->substr(pos, end - pos);
+        pos = end + 1;
+        if (line.empty()) continue;
+        if (line.size() < 3 || line[1] != ' ') {
+            err = "Malformed journal record " + std::to_string(applied + 1);
+            break;
+        }
+
+        const std::string body = line.substr(2);
+        if (line[0] == 'A') {
+            try {
+                inv.addItem(Item::fromJSON(body));   // Already present: the snapshot has it
+            } catch (const std::exception &) {
+                err = "Malformed journal record " + std::to_string(applied + 1);
+                break;
+            }
+        } else if (line[0] == 'R') {
+            auto id = safetyparse(body);
+            if (!id.ok) {
+                err = "Malformed journal record " + std::to_string(applied + 1);
+                break;
+            }
+            inv.removeItem(id.value);
+        } else if (line[0] == 'Q') {
+            const size_t space = body.find(' ');
+            auto id = safetyparse(body.substr(0, space));
+            auto qty = space == std::string::npos ? Result<int>::fail("") : safetyparse(body.substr(space + 1));
+            if (!id.ok || !qty.ok || qty.value < 0) {
+                err = "Malformed journal record " + std::to_string(applied + 1);
+                break;
+            }
+            inv.restoreQuantity(id.value, qty.value);   // Audited when it was first made
+        } else {
+            err = "Unknown journal record type '" + std::string(1, line[0]) + "'";
+            break;
+        }
+        ++applied;
+    }
+
+    std::lock_guard<std::mutex> held(lock);
+    records = applied;
+    return applied;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+//Included files
+#include "Inventory.h"
+#include "Storage.h"
+#include "Item.h"
+
+//Needed libraries
+#include <condition_variable>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <mutex>
+
+// Write-ahead log of inventory mutations, kept next to the snapshot file
+// (`<snapshot>.wal`).
+//
+// Each mutation becomes one line: "A <item json>", "R <id>" or
+// "Q <id> <quantity>". Mutations are staged in memory and written by
+// flush() with a single append, so persisting a command costs O(record)
+// instead of O(catalog). A checkpoint (full snapshot) makes the log
+// redundant, after which reset() truncates it.
+//
+// Records carry absolute values, so replaying a log over a snapshot that
+// already contains some of its effects (a crash between the snapshot
+// rename and the truncate) converges to the same state.
+//
+// Durability (see setDurability):
+//  - None:   flush() appends and returns; the OS decides when it hits disk
+//  - Commit: every flush() appends and fsyncs
+//  - Group:  flush() hands its records to a flusher thread and waits.
+//            Records staged while an fsync is in flight all go out in the
+//            next one, so concurrent commits share a single append + fsync.
+//            A nonzero `window` additionally holds each batch open that long
+//            (or until `windowBytes` are staged), trading commit latency
+//            for fewer fsyncs on slow disks.
+// Staging and flushing are thread-safe.
+class MutationJournal {
+public:
+    static constexpr std::chrono::microseconds DEFAULT_GROUP_WINDOW{0};
+    static constexpr size_t DEFAULT_GROUP_BYTES = 64 * 1024;
+
+    explicit MutationJournal(const std::string &snapshotPath);
+    ~MutationJournal();
+
+    MutationJournal(const MutationJournal &) = delete;
+    MutationJournal& operator=(const MutationJournal &) = delete;
+
+    void setDurability(Durability mode,
+                       std::chrono::microseconds window = DEFAULT_GROUP_WINDOW,
+                       size_t windowBytes = DEFAULT_GROUP_BYTES);
+    Durability durability() const;
+
+    void recordAdd(const Item &item);
+    void recordRemove(int id);
+    void recordQuantity(int id, int quantity);
+
+    // Returns once every record staged so far is written (and synced,
+    // unless the mode is None). On error the records stay staged.
+    std::optional<StorageError> flush();
+    std::optional<StorageError> reset();   // Call after a successful checkpoint
+
+    // Applies the log to `inv` in order. Stops at the first record that is
+    // unterminated (a torn final write) or does not parse, and reports it
+    // in `err`; the caller should checkpoint before appending again.
+    // Returns the number of records applied.
+    size_t replay(Inventory &inv, std::string &err);
+
+    size_t size() const;   // Records since the last checkpoint, staged or written
+    bool hasPending() const;
+    std::string getFilePath() const { return log.getFilePath(); }
+
+private:
+    Storage log;
+
+    mutable std::mutex lock;
+    std::condition_variable wake;       // Flusher: a committer is waiting
+    std::condition_variable written;    // Committers: a write finished
+    std::string pending;                // Staged records, not yet on disk
+    size_t records = 0;                 // Records in the file since the last checkpoint
+    size_t staged = 0;
+    uint64_t stagedSeq = 0;             // Sequence number of the newest staged record
+    uint64_t durableSeq = 0;            // ... of the newest record on disk
+    uint64_t failedSeq = 0;             // ... of the newest record in a failed write
+    std::string lastError;
+    bool writing = false;               // A batch is being written outside the lock
+
+    Durability mode = Durability::None;
+    std::chrono::microseconds groupWindow = DEFAULT_GROUP_WINDOW;
+    size_t groupBytes = DEFAULT_GROUP_BYTES;
+    std::thread flusher;
+    bool stopping = false;
+
+    void stage(const std::string &record);
+    std::optional<StorageError> writeStaged(std::unique_lock<std::mutex> &held, bool sync);
+    void flusherLoop();
+    void stopFlusher();
+};
@@ -0,0 +1,439 @@
+//Included files
+#include "Query.h"
+#include "SortEngine.hpp"
+#include "safetyparse.hpp"
+
+//Needed libraries
+#include <algorithm>
+#include <sstream>
+#include <cstdio>
+#include <limits>
+
+// ─────────────────────────────────────────────
+// Predicates
+// ─────────────────────────────────────────────
+bool Predicate::matches(const Item &item) const {
+    switch (kind) {
+        case Kind::LocationIs:
+            return item.getLocation() == text;
+        case Kind::LocationPrefix:
+            return item.getLocation().compare(0, text.size(), text) == 0;
+        case Kind::LocationUnder: {
+            auto code = LocationCode::parse(item.getLocation());
+            return code && area.contains(*code);
+        }
+        case Kind::QuantityBetween:
+            return item.getQuantity() >= minQty && item.getQuantity() <= maxQty;
+        case Kind::NameContains:
+            if (!ignoreCase) return item.getName().find(text) != std::string::npos;
+            return TrigramIndex::fold(item.getName()).find(TrigramIndex::fold(text)) != std::string::npos;
+        case Kind::CategoryIs:
+            return item.getCategory() == text;
+    }
+    return false;
+}
+
+// ─────────────────────────────────────────────
+// Builder
+// ─────────────────────────────────────────────
+Query& Query::locationIs(const std::string &loc) {
+    auto code = LocationCode::parse(loc);   // Items hold the canonical spelling
+    conditions.push_back({Predicate::Kind::LocationIs, code ? code->toString() : loc});
+    return *this;
+}
+
+Query& Query::locationStartsWith(const std::string &prefix) {
+    conditions.push_back({Predicate::Kind::LocationPrefix, prefix});
+    return *this;
+}
+
+Query& Query::locationUnder(const LocationCode &area) {
+    Predicate p{Predicate::Kind::LocationUnder, area.toString()};
+    p.area = area;
+    conditions.push_back(std::move(p));
+    return *this;
+}
+
+Query& Query::quantityBetween(int minQty, int maxQty) {
+    conditions.push_back({Predicate::Kind::QuantityBetween, "", minQty, maxQty});
+    return *this;
+}
+
+Query& Query::nameContains(const std::string &text, bool ignoreCase) {
+    conditions.push_back({Predicate::Kind::NameContains, text, 0, 0, ignoreCase});
+    return *this;
+}
+
+Query& Query::categoryIs(const std::string &category) {
+    conditions.push_back({Predicate::Kind::CategoryIs, category});
+    return *this;
+}
+
+Query& Query::select(std::vector<QueryField> fields) {
+    columns = std::move(fields);
+    return *this;
+}
+
+Query& Query::orderBy(SortKey key, bool ascending) {
+    ordered = true;
+    orderKey = key;
+    orderAscending = ascending;
+    return *this;
+}
+
+Query& Query::limit(size_t rows) {
+    maxRows = rows;
+    return *this;
+}
+
+bool Query::matches(const Item &item) const {
+    for (const auto &p : conditions) {
+        if (!p.matches(item)) return false;
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────
+// CLI parsing
+// ─────────────────────────────────────────────
+namespace {
+    bool parseField(const std::string &name, QueryField &out) {
+        if (name == "id") out = QueryField::ID;
+        else if (name == "name") out = QueryField::Name;
+        else if (name == "qty") out = QueryField::Quantity;
+        else if (name == "loc") out = QueryField::Location;
+        else if (name == "price") out = QueryField::Price;
+        else if (name == "cat") out = QueryField::Category;
+        else return false;
+        return true;
+    }
+
+    bool parseSortKey(const std::string &name, SortKey &out) {
+        if (name == "id") out = SortKey::ID;
+        else if (name == "name") out = SortKey::Name;
+        else if (name == "qty") out = SortKey::Quantity;
+        else if (name == "loc") out = SortKey::Location;
+        else return false;
+        return true;
+    }
+
+    const char *sortKeyName(SortKey key) {
+        switch (key) {
+            case SortKey::ID:       return "id";
+            case SortKey::Name:     return "name";
+            case SortKey::Quantity: return "qty";
+            case SortKey::Location: return "loc";
+        }
+        return "?";
+    }
+}
+
+Result<Query> Query::parse(const std::pmr::vector<std::pmr::string> &args, bool &explain) {
+    Query q;
+    explain = false;
+
+    for (const auto &token : args) {
+        const std::string_view arg = token;
+        if (arg == "explain") {
+            explain = true;
+            continue;
+        }
+
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos || eq == 0 || eq + 1 == arg.size())
+            return Result<Query>::fail("Bad query term: " + std::string(arg));
+        std::string key(arg.substr(0, eq));
+        std::string value(arg.substr(eq + 1));
+
+        if (key == "loc") {
+            q.locationIs(value);
+        } else if (key == "loc^") {
+            q.locationStartsWith(value);
+        } else if (key == "in") {
+            auto area = LocationCode::parsePrefix(value);
+            if (!area) return Result<Query>::fail("Invalid location prefix: " + value + " (expected ZONE[-AISLE[-RACK[-BIN]]])");
+            q.locationUnder(*area);
+        } else if (key == "name" || key == "iname") {
+            q.nameContains(value, key == "iname");
+        } else if (key == "cat") {
+            q.categoryIs(value);
+        } else if (key == "qty") {
+            // qty=5, qty=1..50, qty=10.. or qty=..3
+            size_t dots = value.find("..");
+            std::string lo = dots == std::string::npos ? value : value.substr(0, dots);
+            std::string hi = dots == std::string::npos ? value : value.substr(dots + 2);
+            int minQty = 0, maxQty = std::numeric_limits<int>::max();
+            if (!lo.empty()) {
+                auto v = safetyparse(lo);
+                if (!v.ok) return Result<Query>::fail(v.error);
+                minQty = v.value;
+            }
+            if (!hi.empty()) {
+                auto v = safetyparse(hi);
+                if (!v.ok) return Result<Query>::fail(v.error);
+                maxQty = v.value;
+            }
+            q.quantityBetween(minQty, maxQty);
+        } else if (key == "fields") {
+            std::vector<QueryField> fields;
+            std::stringstream ss(value);
+            std::string name;
+            while (std::getline(ss, name, ',')) {
+                QueryField f;
+                if (!parseField(name, f)) return Result<Query>::fail("Unknown field: " + name);
+                fields.push_back(f);
+            }
+            q.select(std::move(fields));
+        } else if (key == "order") {
+            bool ascending = value[0] != '-';
+            SortKey sortKey;
+            if (!parseSortKey(ascending ? value : value.substr(1), sortKey))
+                return Result<Query>::fail("Unknown order key: " + value);
+            q.orderBy(sortKey, ascending);
+        } else if (key == "limit") {
+            auto v = safetyparse(value);
+            if (!v.ok || v.value < 0) return Result<Query>::fail("Invalid limit: " + value);
+            q.limit(static_cast<size_t>(v.value));
+        } else {
+            return Result<Query>::fail("Unknown query key: " + key);
+        }
+    }
+    return Result<Query>::success(std::move(q));
+}
+
+// ─────────────────────────────────────────────
+// Planner
+// ─────────────────────────────────────────────
+QueryPlan QueryEngine::plan(const Query &q) const {
+    QueryPlan best;
+    best.estimatedRows = inventory.totalItems();
+
+    // Pick the access path that touches the fewest rows. Range estimates
+    // stop counting once they can no longer beat the current best.
+    const auto &preds = q.predicates();
+    for (size_t i = 0; i < preds.size() && best.estimatedRows > 0; ++i) {
+        const Predicate &p = preds[i];
+        QueryPlan::Access access = QueryPlan::Access::FullScan;
+        size_t estimate = SIZE_MAX;
+
+        switch (p.kind) {
+            case Predicate::Kind::LocationIs:
+                access = QueryPlan::Access::LocationIndex;
+                estimate = inventory.estimateLocation(p.text);
+                break;
+            case Predicate::Kind::LocationPrefix:
+                access = QueryPlan::Access::LocationPrefix;
+                estimate = inventory.estimateLocationPrefix(p.text, best.estimatedRows);
+                break;
+            case Predicate::Kind::LocationUnder:
+                access = QueryPlan::Access::LocationTree;
+                estimate = inventory.estimateLocationTree(p.area);
+                break;
+            case Predicate::Kind::QuantityBetween:
+                access = QueryPlan::Access::QuantityIndex;
+                estimate = inventory.estimateQuantity(p.minQty, p.maxQty, best.estimatedRows);
+                break;
+            case Predicate::Kind::NameContains:
+                access = QueryPlan::Access::NameIndex;
+                estimate = inventory.estimateName(p.text);
+                break;
+            case Predicate::Kind::CategoryIs:
+                // No ID index, but the maintained totals prove emptiness
+                if (inventory.totalsForCategory(p.text).items == 0) {
+                    access = QueryPlan::Access::Empty;
+                    estimate = 0;
+                }
+                break;
+        }
+
+        if (estimate < best.estimatedRows) {
+            best.access = access;
+            best.driver = i;
+            best.estimatedRows = estimate;
+        }
+    }
+
+    if (!q.hasOrder() || best.access == QueryPlan::Access::Empty) return best;
+
+    // Does the chosen path already produce the requested order?
+    const bool inOrder =
+        (best.access == QueryPlan::Access::QuantityIndex && q.order() == SortKey::Quantity) ||
+        (best.access == QueryPlan::Access::LocationPrefix && q.order() == SortKey::Location && q.ascending());
+    if (inOrder) return best;
+
+    // With a limit and no selective index, walking the order index lets us
+    // stop after `limit` matches instead of sorting everything.
+    if (q.rowLimit() != SIZE_MAX && best.estimatedRows * 2 > inventory.totalItems()) {
+        best.access = QueryPlan::Access::OrderIndex;
+        best.driver = SIZE_MAX;
+        best.estimatedRows = inventory.totalItems();
+        return best;
+    }
+
+    best.needsSort = true;
+    return best;
+}
+
+std::string QueryPlan::describe(const Query &q) const {
+    std::ostringstream ss;
+    switch (access) {
+        case Access::FullScan:       ss << "full scan"; break;
+        case Access::LocationIndex:  ss << "location hash index"; break;
+        case Access::LocationPrefix: ss << "location ordered index (prefix range)"; break;
+        case Access::LocationTree:   ss << "location trie (subtree)"; break;
+        case Access::QuantityIndex:  ss << "quantity ordered index (range)"; break;
+        case Access::NameIndex:      ss << "name trigram index"; break;
+        case Access::OrderIndex:     ss << sortKeyName(q.order()) << " ordered index (walk in order)"; break;
+        case Access::Empty:          ss << "no scan (category has no items)"; break;
+    }
+    ss << ", ~" << estimatedRows << " rows examined";
+
+    const size_t residual = q.predicates().size() - (driver == SIZE_MAX ? 0 : 1);
+    if (residual > 0) ss << ", " << residual << " residual filter(s)";
+    if (needsSort) ss << ", then sort by " << sortKeyName(q.order());
+    if (q.rowLimit() != SIZE_MAX) ss << ", limit " << q.rowLimit();
+    return ss.str();
+}
+
+// ─────────────────────────────────────────────
+// Execution
+// ─────────────────────────────────────────────
+namespace {
+    using MatchList = std::pmr::vector<const Item*>;
+
+    template<bool Ascending>
+    void sortView(MatchList &view, SortKey key) {
+        MatchList sorted(view.get_allocator());
+        sorted.reserve(view.size());
+
+        if (key == SortKey::ID || key == SortKey::Quantity) {
+            std::vector<SortEngine::IntRow> rows;
+            rows.reserve(view.size());
+            for (uint32_t i = 0; i < view.size(); ++i) {
+                const Item &item = *view[i];
+                const int k = key == SortKey::ID ? item.getId() : item.getQuantity();
+                rows.push_back(SortEngine::intRow(k, item.getId(), i));
+            }
+            SortEngine::sort<Ascending>(rows);
+            for (const auto &row : rows) sorted.push_back(view[row.ref]);
+        } else {
+            std::vector<SortEngine::TextRow> rows;
+            rows.reserve(view.size());
+            for (uint32_t i = 0; i < view.size(); ++i) {
+                const Item &item = *view[i];
+                // Both accessors return references into long-lived storage
+                const std::string &text = key == SortKey::Name ? item.getName() : item.getLocation();
+                rows.push_back(SortEngine::textRow(text, item.getId(), i));
+            }
+            SortEngine::sort<Ascending>(rows);
+            for (const auto &row : rows) sorted.push_back(view[row.ref]);
+        }
+        view.swap(sorted);
+    }
+}
+
+size_t QueryEngine::run(const Query &q, const ItemVisitor &sink, std::pmr::memory_resource *scratch) const {
+    const QueryPlan p = plan(q);
+    const size_t limit = q.rowLimit();
+    if (p.access == QueryPlan::Access::Empty || limit == 0) return 0;
+
+    size_t emitted = 0;
+    MatchList matched(scratch);   // Only used when a sort is unavoidable
+
+    ItemVisitor filter = [&](const Item &item) {
+        if (!q.matches(item)) return true;
+        if (p.needsSort) {
+            matched.push_back(&item);
+            return true;
+        }
+        ++emitted;
+        return sink(item) && emitted < limit;
+    };
+
+    const Predicate *d = (p.driver == SIZE_MAX) ? nullptr : &q.predicates()[p.driver];
+    switch (p.access) {
+        case QueryPlan::Access::LocationIndex:
+            inventory.scanLocation(d->text, filter);
+            break;
+        case QueryPlan::Access::LocationPrefix:
+            inventory.scanLocationPrefix(d->text, filter);
+            break;
+        case QueryPlan::Access::LocationTree:
+            inventory.scanLocationTree(d->area, filter);
+            break;
+        case QueryPlan::Access::QuantityIndex:
+            inventory.scanQuantity(d->minQty, d->maxQty,
+                                   !(q.hasOrder() && q.order() == SortKey::Quantity && !q.ascending()), filter);
+            break;
+        case QueryPlan::Access::NameIndex:
+            if (!inventory.scanNameCandidates(d->text, filter)) inventory.scanAll(filter);
+            break;
+        case QueryPlan::Access::OrderIndex:
+            inventory.scanOrdered(q.order(), q.ascending(), filter);
+            break;
+        case QueryPlan::Access::FullScan:
+        case QueryPlan::Access::Empty:
+            inventory.scanAll(filter);
+            break;
+    }
+
+    if (!p.needsSort) return emitted;
+
+    if (q.ascending()) sortView<true>(matched, q.order());
+    else sortView<false>(matched, q.order());
+
+    for (const Item *item : matched) {
+        ++emitted;
+        if (!sink(*item) || emitted >= limit) break;
+    }
+    return emitted;
+}
+
+// ─────────────────────────────────────────────
+// Projection
+// ─────────────────────────────────────────────
+namespace {
+    const std::vector<QueryField> &columnsOf(const Query &q) {
+        static const std::vector<QueryField> defaults = {
+            QueryField::ID, QueryField::Name, QueryField::Quantity, QueryField::Location
+        };
+        return q.fields().empty() ? defaults : q.fields();
+    }
+}
+
+std::vector<std::string> QueryEngine::headers(const Query &q) {
+    std::vector<std::string> out;
+    for (QueryField f : columnsOf(q)) {
+        switch (f) {
+            case QueryField::ID:       out.push_back("ID"); break;
+            case QueryField::Name:     out.push_back("Name"); break;
+            case QueryField::Quantity: out.push_back("Quantity"); break;
+            case QueryField::Location: out.push_back("Location"); break;
+            case QueryField::Price:    out.push_back("Price"); break;
+            case QueryField::Category: out.push_back("Category"); break;
+        }
+    }
+    return out;
+}
+
+void QueryEngine::project(const Query &q, const Item &item, std::pmr::vector<std::pmr::string> &row) {
+    const auto &columns = columnsOf(q);
+    row.reserve(row.size() + columns.size());
+
+    // Numbers are formatted on the stack so only the row's resource allocates
+    char buf[48];
+    auto text = [&](int length) {
+        return std::string_view(buf, std::min(static_cast<size_t>(std::max(length, 0)), sizeof(buf) - 1));
+    };
+
+    for (QueryField f : columns) {
+        switch (f) {
+            case QueryField::ID:       row.emplace_back(text(std::snprintf(buf, sizeof(buf), "%d", item.getId()))); break;
+            case QueryField::Name:     row.emplace_back(item.getName()); break;
+            case QueryField::Quantity: row.emplace_back(text(std::snprintf(buf, sizeof(buf), "%d", item.getQuantity()))); break;
+            case QueryField::Location: row.emplace_back(item.getLocation()); break;
+            case QueryField::Price:    row.emplace_back(text(std::snprintf(buf, sizeof(buf), "%.2f", item.getPrice()))); break;
+            case QueryField::Category: row.emplace_back(item.getCategory()); break;
+        }
+    }
+}
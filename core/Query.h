@@ -0,0 +1,95 @@
+#pragma once
+
+//Included files
+#include "LocationCode.h"
+#include "Inventory.h"
+#include "results.hpp"
+
+//Needed libraries
+#include <memory_resource>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Columns a query can project
+enum class QueryField { ID, Name, Quantity, Location, Price, Category };
+
+// One condition. All predicates of a Query are ANDed together.
+struct Predicate {
+    enum class Kind { LocationIs, LocationPrefix, LocationUnder, QuantityBetween, NameContains, CategoryIs };
+
+    Kind kind;
+    std::string text;          // Location, prefix, name fragment or category
+    int minQty = 0;
+    int maxQty = 0;
+    bool ignoreCase = false;   // NameContains only
+    LocationCode area{};       // LocationUnder only
+
+    bool matches(const Item &item) const;
+};
+
+// Composable inventory query: predicates + projection + ordering + limit
+class Query {
+private:
+    std::vector<Predicate> conditions;
+    std::vector<QueryField> columns;
+    bool ordered = false;
+    SortKey orderKey = SortKey::ID;
+    bool orderAscending = true;
+    size_t maxRows = SIZE_MAX;
+
+public:
+    Query& locationIs(const std::string &loc);
+    Query& locationStartsWith(const std::string &prefix);       // Text prefix
+    Query& locationUnder(const LocationCode &area);             // Zone/aisle/rack subtree
+    Query& quantityBetween(int minQty, int maxQty);
+    Query& nameContains(const std::string &text, bool ignoreCase = false);
+    Query& categoryIs(const std::string &category);
+    Query& select(std::vector<QueryField> fields);
+    Query& orderBy(SortKey key, bool ascending = true);
+    Query& limit(size_t rows);
+
+    bool matches(const Item &item) const;
+
+    const std::vector<Predicate>& predicates() const { return conditions; }
+    const std::vector<QueryField>& fields() const { return columns; }   // Empty = default columns
+    bool hasOrder() const { return ordered; }
+    SortKey order() const { return orderKey; }
+    bool ascending() const { return orderAscending; }
+    size_t rowLimit() const { return maxRows; }
+
+    // CLI form: loc=A loc^=B- in=B-07 qty=1..50 name=bolt iname=bolt cat=tools
+    //           fields=id,name order=-qty limit=20 explain
+    static Result<Query> parse(const std::pmr::vector<std::pmr::string> &args, bool &explain);
+};
+
+// How the planner decided to execute a query
+struct QueryPlan {
+    enum class Access { FullScan, LocationIndex, LocationPrefix, LocationTree, QuantityIndex, NameIndex, OrderIndex, Empty };
+
+    Access access = Access::FullScan;
+    size_t driver = SIZE_MAX;   // Predicate feeding the access path
+    size_t estimatedRows = 0;
+    bool needsSort = false;     // Access order differs from the requested order
+
+    std::string describe(const Query &q) const;
+};
+
+// Plans and streams queries over an Inventory. Results are handed to the
+// sink as const references; only an unavoidable sort collects pointers.
+class QueryEngine {
+private:
+    const Inventory &inventory;
+
+public:
+    explicit QueryEngine(const Inventory &inv) : inventory(inv) {}
+
+    QueryPlan plan(const Query &q) const;
+    // Returns rows emitted. Matches that must be sorted first are collected in `scratch`.
+    size_t run(const Query &q, const ItemVisitor &sink,
+               std::pmr::memory_resource *scratch = std::pmr::get_default_resource()) const;
+
+    static std::vector<std::string> headers(const Query &q);
+    // Appends the selected columns of `item` to `row` (allocating from row's resource)
+    static void project(const Query &q, const Item &item, std::pmr::vector<std::pmr::string> &row);
+};
@@ -41,7 +41,7 @@ string Receipt::formatTime(const chrono::system_clock::time_point& tp) {
 // ─────────────────────────────────────────────
 // Constructor
 // ─────────────────────────────────────────────
-Receipt::Receipt() {
+Receipt::Receipt(pmr::memory_resource* mem) : items(mem) {
     receiptNumber = generateReceiptNumber();
     timestamp = chrono::system_clock::now();
 }
@@ -73,8 +73,8 @@ void Receipt::addItem(const Item& item, int quantity, double unitPrice) {
 
     items.push_back({
         item.getId(),
-        item.getName(),
-        item.getLocation(),
+        StringPool::intern(item.getName()),
+        item.getLocationId(),
         quantity,
         unitPrice
     });
@@ -122,7 +122,7 @@ void Receipt::print() const {
 
     for (const auto& i : items) {
         cout << left << setw(5) << i.id
-             << setw(15) << i.name
+             << setw(15) << StringPool::str(i.name)
              << setw(6) << i.quantity
              << setw(10) << fixed << setprecision(2) << i.unitPrice
              << setw(10) << i.lineTotal() << "\n";
@@ -206,8 +206,8 @@ string Receipt::toJSON() const {
         const auto& item = items[i];
         ss << "    {\n";
         ss << "      \"id\": " << item.id << ",\n";
-        ss << "      \"name\": \"" << escapeJSON(item.name) << "\",\n";
-        ss << "      \"location\": \"" << escapeJSON(item.location) << "\",\n";
+        ss << "      \"name\": \"" << escapeJSON(StringPool::str(item.name)) << "\",\n";
+        ss << "      \"location\": \"" << escapeJSON(StringPool::str(item.location)) << "\",\n";
         ss << "      \"quantity\": " << item.quantity << ",\n";
         ss << "      \"unitPrice\": " << fixed << setprecision(2) << item.unitPrice << ",\n";
         ss << "      \"lineTotal\": " << item.lineTotal() << "\n";
@@ -359,8 +359,8 @@ Receipt Receipt::fromJSON(const string& jsonStr) {
                         
                         ReceiptItem item;
                         item.id = (int)getItemNumber("id");
-                        item.name = getItemString("name");
-                        item.location = getItemString("location");
+                        item.name = StringPool::intern(getItemString("name"));
+                        item.location = StringPool::intern(getItemString("location"));
                         item.quantity = (int)getItemNumber("quantity");
                         item.unitPrice = getItemNumber("unitPrice");
                         
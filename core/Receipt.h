@@ -5,14 +5,15 @@
 
 //needed libraries
 #include <unordered_map>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <chrono>
 
 struct ReceiptItem {
     int id;
-    std::string name;
-    std::string location;
+    Symbol name;        // Interned in StringPool
+    Symbol location;
     int quantity;
     double unitPrice;
     double lineTotal() const { return quantity * unitPrice; }
@@ -20,7 +21,8 @@ struct ReceiptItem {
 
 class Receipt {
 public:
-    Receipt();
+    // Line items are allocated from `mem` (e.g. a command's arena)
+    explicit Receipt(std::pmr::memory_resource* mem = std::pmr::get_default_resource());
 
     void setCustomer(const std::string& name, const std::string& phone = "", const std::string& email = "");
 
@@ -49,7 +51,7 @@ private:
     std::string customerPhone;
     std::string customerEmail;
 
-    std::vector<ReceiptItem> items;
+    std::pmr::vector<ReceiptItem> items;
 
     static std::string generateReceiptNumber();
     static std::string formatTime(const std::chrono::system_clock::time_point& tp);
@@ -0,0 +1,43 @@
+//Included files
+#include "ReorderQueue.h"
+
+//Needed libraries
+#include <algorithm>
+
+ReorderQueue::ReorderQueue(size_t capacity) : ring(std::max<size_t>(capacity, 1)) {}
+
+void ReorderQueue::push(const ReorderEvent &event) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (count == ring.size()) {
+        // Full: overwrite the oldest so the freshest state always survives
+        ring[head] = event;
+        head = (head + 1) % ring.size();
+        ++overflow;
+        return;
+    }
+    ring[(head + count) % ring.size()] = event;
+    ++count;
+}
+
+std::vector<ReorderEvent> ReorderQueue::drain(size_t max) {
+    std::lock_guard<std::mutex> guard(lock);
+    const size_t n = std::min(max, count);
+
+    std::vector<ReorderEvent> out;
+    out.reserve(n);
+    for (size_t i = 0; i < n; ++i) out.push_back(ring[(head + i) % ring.size()]);
+
+    head = (head + n) % ring.size();
+    count -= n;
+    return out;
+}
+
+size_t ReorderQueue::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return count;
+}
+
+uint64_t ReorderQueue::dropped() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return overflow;
+}
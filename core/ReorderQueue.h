@@ -0,0 +1,44 @@
+#pragma once
+
+//Needed libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <ctime>
+#include <mutex>
+
+// One reorder-threshold crossing. `below` is true when the quantity fell
+// under the threshold and false when it was restocked back to it.
+struct ReorderEvent {
+    int64_t timestamp;
+    int32_t itemId;
+    int32_t quantity;    // Quantity after the change
+    int32_t threshold;   // Threshold in effect at the time
+    bool below;
+};
+
+// Bounded in-process FIFO of reorder events.
+//
+// Storage is a fixed ring allocated once, so a push never allocates. When
+// the consumer falls behind, the oldest event is overwritten and counted
+// in dropped(). Push and drain may run on different threads.
+class ReorderQueue {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit ReorderQueue(size_t capacity = DEFAULT_CAPACITY);
+
+    void push(const ReorderEvent &event);
+    std::vector<ReorderEvent> drain(size_t max = SIZE_MAX);   // Oldest first
+
+    size_t size() const;
+    size_t capacity() const { return ring.size(); }
+    uint64_t dropped() const;
+
+private:
+    std::vector<ReorderEvent> ring;
+    size_t head = 0;      // Oldest event
+    size_t count = 0;
+    uint64_t overflow = 0;
+    mutable std::mutex lock;
+};
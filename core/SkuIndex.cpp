@@ -0,0 +1,135 @@
+//Included files
+#include "SkuIndex.h"
+
+//Needed libraries
+#include <algorithm>
+
+namespace {
+    constexpr uint32_t MAX_PILOT = 1u << 24;   // Give up (and use the overlay) beyond this
+}
+
+// ─────────────────────────────────────────────
+// Static build
+// ─────────────────────────────────────────────
+bool SkuIndex::build(const std::vector<std::pair<std::string_view, int>> &entries) {
+    clear();
+
+    // Sort by hash to find duplicates: equal SKUs keep their first entry,
+    // while two distinct SKUs with one 64-bit hash can never be separated
+    std::vector<std::pair<uint64_t, uint32_t>> byHash;   // (hash, entry)
+    byHash.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].first.empty()) byHash.emplace_back(hash(entries[i].first), static_cast<uint32_t>(i));
+    }
+    std::sort(byHash.begin(), byHash.end());
+
+    std::vector<std::pair<std::string_view, int>> keys;
+    std::vector<uint64_t> hashes;
+    keys.reserve(byHash.size());
+    hashes.reserve(byHash.size());
+    bool collision = false;
+    for (size_t i = 0; i < byHash.size(); ++i) {
+        const auto &entry = entries[byHash[i].second];
+        if (i > 0 && byHash[i].first == byHash[i - 1].first) {
+            if (entry.first == entries[byHash[i - 1].second].first) continue;   // Duplicate SKU
+            collision = true;
+        }
+        keys.push_back(entry);
+        hashes.push_back(byHash[i].first);
+    }
+
+    const size_t n = keys.size();
+    if (n == 0) return true;
+
+    auto fallBack = [&] {
+        clear();
+        for (const auto &[sku, id] : keys) overlay.emplace(std::string(sku), id);
+        return false;
+    };
+    if (collision) return fallBack();
+
+    // ~4 keys per bucket, table 3% larger than n
+    pilots.assign(n / 4 + 1, 0);
+    tableSize = n + n / 32 + 1;
+
+    // Place the largest buckets first, while the table is still empty
+    std::vector<std::pair<size_t, uint32_t>> order(n);   // (bucket, key)
+    for (size_t i = 0; i < n; ++i) order[i] = {bucketOf(hashes[i]), static_cast<uint32_t>(i)};
+    std::sort(order.begin(), order.end());
+
+    std::vector<std::pair<size_t, size_t>> groups;   // [begin, end) into `order`
+    for (size_t i = 0; i < n;) {
+        size_t j = i;
+        while (j < n && order[j].first == order[i].first) ++j;
+        groups.emplace_back(i, j);
+        i = j;
+    }
+    std::stable_sort(groups.begin(), groups.end(), [](const auto &a, const auto &b) {
+        return a.second - a.first > b.second - b.first;
+    });
+
+    std::vector<bool> taken(tableSize, false);
+    std::vector<uint64_t> positionOfKey(n);
+    std::vector<uint64_t> trial;
+
+    for (const auto &[begin, end] : groups) {
+        const size_t bucket = order[begin].first;
+        uint32_t pilot = 0;
+        for (;; ++pilot) {
+            if (pilot == MAX_PILOT) return fallBack();
+
+            trial.clear();
+            bool ok = true;
+            for (size_t k = begin; k < end && ok; ++k) {
+                const uint64_t pos = positionOf(hashes[order[k].second], pilot);
+                ok = !taken[pos] && std::find(trial.begin(), trial.end(), pos) == trial.end();
+                trial.push_back(pos);
+            }
+            if (ok) break;
+        }
+
+        pilots[bucket] = pilot;
+        for (size_t k = begin; k < end; ++k) {
+            const uint64_t pos = trial[k - begin];
+            taken[pos] = true;
+            positionOfKey[order[k].second] = pos;
+        }
+    }
+
+    // Minimal: send every position >= n into a hole below n
+    remap.assign(tableSize - n, 0);
+    size_t hole = 0;
+    for (uint64_t pos = n; pos < tableSize; ++pos) {
+        if (!taken[pos]) continue;
+        while (taken[hole]) ++hole;
+        remap[pos - n] = static_cast<uint32_t>(hole++);
+    }
+
+    slots.assign(n, Slot{0, NOT_FOUND});
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t pos = positionOfKey[i];
+        const size_t slot = pos < n ? static_cast<size_t>(pos) : remap[pos - n];
+        slots[slot] = Slot{static_cast<uint32_t>(hashes[i]), keys[i].second};
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────
+// Overlay
+// ─────────────────────────────────────────────
+void SkuIndex::insert(const std::string &sku, int id) {
+    if (!sku.empty()) overlay[sku] = id;
+}
+
+void SkuIndex::erase(const std::string &sku, int id) {
+    auto it = overlay.find(sku);
+    if (it != overlay.end() && it->second == id) overlay.erase(it);
+}
+
+void SkuIndex::clear() {
+    pilots.clear();
+    remap.clear();
+    slots.clear();
+    tableSize = 0;
+    overlay.clear();
+}
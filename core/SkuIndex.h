@@ -0,0 +1,112 @@
+#pragma once
+
+//Needed libraries
+#include <unordered_map>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <string>
+#include <vector>
+
+// SKU/barcode -> item ID for read-mostly catalogs.
+//
+// build() compiles the current SKUs into a static minimal perfect hash
+// (PTHash-style: one pilot per bucket, positions past n remapped into the
+// holes below n). A lookup costs one string hash and three array reads,
+// with no probing. A 32-bit tag per slot rejects almost every unknown
+// SKU without touching the item.
+//
+// SKUs added after build() go into a small overlay map; removals only
+// touch the overlay, so static hits must be confirmed by the caller
+// (see find). Rebuild to fold the overlay back into the static table.
+class SkuIndex {
+public:
+    static constexpr int NOT_FOUND = -1;
+
+    // Replaces the static table (and clears the overlay). Duplicate SKUs
+    // keep their first entry. Returns false if no perfect hash was found,
+    // in which case every entry lives in the overlay instead.
+    bool build(const std::vector<std::pair<std::string_view, int>> &entries);
+
+    void insert(const std::string &sku, int id);   // Overlay
+    void erase(const std::string &sku, int id);    // Overlay
+    void clear();
+
+    // `confirm(id, sku)` must say whether item `id` still carries `sku`;
+    // it is consulted only for static hits, which may be stale
+    template<typename Confirm>
+    int find(std::string_view sku, Confirm confirm) const {
+        if (!slots.empty()) {
+            const uint64_t h = hash(sku);
+            const Slot &slot = slots[slotOf(h)];
+            if (slot.tag == static_cast<uint32_t>(h) && slot.id != NOT_FOUND && confirm(slot.id, sku)) return slot.id;
+        }
+        if (overlay.empty()) return NOT_FOUND;
+        auto it = overlay.find(std::string(sku));   // C++17 maps have no heterogeneous find
+        return it == overlay.end() ? NOT_FOUND : it->second;
+    }
+
+    size_t staticSize() const { return slots.size(); }
+    size_t overlaySize() const { return overlay.size(); }
+
+    static uint64_t hash(std::string_view text) {
+        const uint64_t k1 = 0x87c37b91114253d5ULL;
+        const uint64_t k2 = 0x4cf5ad432745937fULL;
+        uint64_t h = 0x9E3779B97F4A7C15ULL ^ (text.size() * k1);
+
+        size_t i = 0;
+        for (; i + 8 <= text.size(); i += 8) {
+            uint64_t w;
+            std::memcpy(&w, text.data() + i, 8);
+            h = rotl(h ^ (w * k1), 31) * k2;
+        }
+        if (i < text.size()) {
+            uint64_t w = 0;
+            std::memcpy(&w, text.data() + i, text.size() - i);
+            h = rotl(h ^ (w * k1), 31) * k2;
+        }
+        return mix(h);
+    }
+
+private:
+    struct Slot {
+        uint32_t tag;   // Low 32 bits of the key's hash
+        int32_t id;
+    };
+
+    // Static table (n = slots.size())
+    std::vector<uint32_t> pilots;   // One per bucket
+    std::vector<uint32_t> remap;    // Position - n -> final slot, for positions >= n
+    std::vector<Slot> slots;
+    uint64_t tableSize = 0;         // m >= n positions before remapping
+
+    struct TextHash {
+        size_t operator()(std::string_view text) const { return static_cast<size_t>(hash(text)); }
+    };
+    std::unordered_map<std::string, int, TextHash> overlay;
+
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+    static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    // Maps a 32-bit value onto [0, range) without a division
+    static uint64_t reduce(uint32_t x, uint64_t range) { return (static_cast<uint64_t>(x) * range) >> 32; }
+
+    size_t bucketOf(uint64_t h) const {
+        return static_cast<size_t>(reduce(static_cast<uint32_t>(h >> 32), pilots.size()));
+    }
+    uint64_t positionOf(uint64_t h, uint32_t pilot) const {
+        return reduce(static_cast<uint32_t>(mix(h ^ (pilot * 0x9E3779B97F4A7C15ULL))), tableSize);
+    }
+    size_t slotOf(uint64_t h) const {
+        const uint64_t pos = positionOf(h, pilots[bucketOf(h)]);
+        return pos < slots.size() ? static_cast<size_t>(pos) : remap[pos - slots.size()];
+    }
+};
@@ -0,0 +1,250 @@
+//Included files
+#include "Snapshot.h"
+#include "output.h"
+
+//Needed libraries
+#include <unordered_map>
+#include <stdexcept>
+#include <cstring>
+#include <limits>
+
+// ─────────────────────────────────────────────
+// Layout
+// ─────────────────────────────────────────────
+// Fields are written and read a byte at a time in little-endian order,
+// so the file is the same whatever the host's byte order or padding.
+namespace {
+    constexpr char MAGIC[8] = {'W', 'M', 'S', 'X', 'S', 'N', 'A', 'P'};
+    constexpr size_t HEADER_SIZE = 64;
+    constexpr size_t RECORD_SIZE = 64;
+    constexpr size_t NAMED_REJECTS = 3;   // Invalid records spelled out in the load error
+
+    struct Header {
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t itemCount;
+        uint64_t recordsOffset;
+        uint64_t heapOffset;
+        uint64_t heapSize;
+        uint64_t checksum;      // Of bytes [recordsOffset, end of file)
+    };
+
+    struct Span {
+        uint32_t offset;        // Into the heap
+        uint32_t length;
+    };
+
+    struct Record {
+        int32_t id;
+        int32_t quantity;
+        double price;
+        Span name;
+        Span sku;
+        Span location;
+        Span currency;
+        Span unit;
+        Span category;
+    };
+
+    void store32(char *at, uint32_t v) {
+        for (int i = 0; i < 4; ++i) at[i] = static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+    void store64(char *at, uint64_t v) {
+        for (int i = 0; i < 8; ++i) at[i] = static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+    uint32_t load32(const char *at) {
+        uint32_t v = 0;
+        for (int i = 3; i >= 0; --i) v = (v << 8) | static_cast<unsigned char>(at[i]);
+        return v;
+    }
+    uint64_t load64(const char *at) {
+        uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | static_cast<unsigned char>(at[i]);
+        return v;
+    }
+
+    // Header: magic, version, recordSize, itemCount, recordsOffset,
+    // heapOffset, heapSize, checksum; the last 8 bytes are reserved (zero)
+    void writeHeader(char *at, const Header &h) {
+        std::memcpy(at, MAGIC, sizeof(MAGIC));
+        store32(at + 8, h.version);
+        store32(at + 12, h.recordSize);
+        store64(at + 16, h.itemCount);
+        store64(at + 24, h.recordsOffset);
+        store64(at + 32, h.heapOffset);
+        store64(at + 40, h.heapSize);
+        store64(at + 48, h.checksum);
+        store64(at + 56, 0);
+    }
+    Header readHeader(const char *at) {
+        return Header{load32(at + 8), load32(at + 12), load64(at + 16), load64(at + 24),
+                      load64(at + 32), load64(at + 40), load64(at + 48)};
+    }
+
+    // Record: id, quantity, price (IEEE-754 bits), then six (offset, length) spans
+    void writeRecord(char *at, const Record &r) {
+        uint64_t priceBits;
+        std::memcpy(&priceBits, &r.price, sizeof(priceBits));
+        store32(at, static_cast<uint32_t>(r.id));
+        store32(at + 4, static_cast<uint32_t>(r.quantity));
+        store64(at + 8, priceBits);
+        const Span spans[] = {r.name, r.sku, r.location, r.currency, r.unit, r.category};
+        for (size_t i = 0; i < 6; ++i) {
+            store32(at + 16 + 8 * i, spans[i].offset);
+            store32(at + 20 + 8 * i, spans[i].length);
+        }
+    }
+    Record readRecord(const char *at) {
+        Record r;
+        r.id = static_cast<int32_t>(load32(at));
+        r.quantity = static_cast<int32_t>(load32(at + 4));
+        const uint64_t priceBits = load64(at + 8);
+        std::memcpy(&r.price, &priceBits, sizeof(priceBits));
+        Span *spans[] = {&r.name, &r.sku, &r.location, &r.currency, &r.unit, &r.category};
+        for (size_t i = 0; i < 6; ++i) *spans[i] = Span{load32(at + 16 + 8 * i), load32(at + 20 + 8 * i)};
+        return r;
+    }
+
+    uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+}
+
+// Murmur-style: 64-bit little-endian words folded with multiply/rotate,
+// then a final avalanche mix
+uint64_t Snapshot::checksum(std::string_view bytes) {
+    const uint64_t k1 = 0x87c37b91114253d5ULL;
+    const uint64_t k2 = 0x4cf5ad432745937fULL;
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ bytes.size();
+
+    size_t i = 0;
+    for (; i + 8 <= bytes.size(); i += 8) {
+        const uint64_t w = load64(bytes.data() + i);
+        h = rotl(h ^ (w * k1), 31) * k2;
+    }
+    if (i < bytes.size()) {
+        char tail[8] = {};
+        std::memcpy(tail, bytes.data() + i, bytes.size() - i);
+        h = rotl(h ^ (load64(tail) * k1), 31) * k2;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// ─────────────────────────────────────────────
+// Encode
+// ─────────────────────────────────────────────
+Result<std::string> Snapshot::encode(const Inventory &inv) {
+    const size_t count = inv.totalItems();
+    std::vector<Record> records;
+    records.reserve(count);
+
+    std::string heap;
+    std::unordered_map<Symbol, Span> interned;   // One heap copy per distinct symbol
+    bool overflow = false;
+
+    auto put = [&](std::string_view text) {
+        if (heap.size() + text.size() > std::numeric_limits<uint32_t>::max()) {
+            overflow = true;
+            return Span{0, 0};
+        }
+        Span span{static_cast<uint32_t>(heap.size()), static_cast<uint32_t>(text.size())};
+        heap.append(text);
+        return span;
+    };
+    auto putSymbol = [&](Symbol sym) {
+        auto it = interned.find(sym);
+        if (it != interned.end()) return it->second;
+        return interned.emplace(sym, put(StringPool::str(sym))).first->second;
+    };
+
+    inv.visitItems([&](const Item &item) {
+        records.push_back(Record{
+            item.getId(), item.getQuantity(), item.getPrice(),
+            put(item.getName()), put(item.getSku()),
+            putSymbol(item.getLocationId()), putSymbol(item.getCurrencyId()),
+            putSymbol(item.getUnitId()), putSymbol(item.getCategoryId())
+        });
+    });
+    if (overflow) return Result<std::string>::fail("Snapshot string heap exceeds 4 GiB");
+
+    Header header{};
+    header.version = VERSION;
+    header.recordSize = RECORD_SIZE;
+    header.itemCount = records.size();
+    header.recordsOffset = HEADER_SIZE;
+    header.heapOffset = header.recordsOffset + records.size() * RECORD_SIZE;
+    header.heapSize = heap.size();
+
+    std::string image(header.heapOffset + heap.size(), '\0');
+    for (size_t i = 0; i < records.size(); ++i)
+        writeRecord(&image[header.recordsOffset + i * RECORD_SIZE], records[i]);
+    std::memcpy(&image[header.heapOffset], heap.data(), heap.size());
+    header.checksum = checksum(std::string_view(image).substr(header.recordsOffset));
+    writeHeader(&image[0], header);
+    return Result<std::string>::success(std::move(image));
+}
+
+// ─────────────────────────────────────────────
+// Decode
+// ─────────────────────────────────────────────
+Result<size_t> Snapshot::decode(std::string_view image, Inventory &inv) {
+    if (image.size() < HEADER_SIZE) return Result<size_t>::fail("Snapshot is truncated");
+    if (std::memcmp(image.data(), MAGIC, sizeof(MAGIC)) != 0)
+        return Result<size_t>::fail("Not a WMS-X snapshot");
+    const Header header = readHeader(image.data());
+    if (header.version != VERSION)
+        return Result<size_t>::fail("Unsupported snapshot version " + std::to_string(header.version));
+    if (header.recordSize != RECORD_SIZE || header.recordsOffset != HEADER_SIZE
+        || header.itemCount > (image.size() - HEADER_SIZE) / RECORD_SIZE
+        || header.heapOffset != header.recordsOffset + header.itemCount * RECORD_SIZE
+        || header.heapSize > image.size() || header.heapOffset + header.heapSize != image.size())
+        return Result<size_t>::fail("Snapshot layout does not match its size");
+    if (checksum(image.substr(header.recordsOffset)) != header.checksum)
+        return Result<size_t>::fail("Snapshot checksum mismatch");
+
+    const char *records = image.data() + header.recordsOffset;
+    const std::string_view heap = image.substr(header.heapOffset);
+    auto text = [&](Span s) {
+        if (static_cast<uint64_t>(s.offset) + s.length > heap.size()) throw std::invalid_argument("Snapshot string out of range");
+        return heap.substr(s.offset, s.length);
+    };
+
+    // Same policy as fromJSON: records that no longer validate fail the
+    // load, named in the error, so no checkpoint is written without them.
+    // Records whose ID or SKU is already taken are skipped with a warning.
+    size_t added = 0;
+    size_t rejected = 0;
+    size_t duplicates = 0;
+    std::string rejectedNames;
+    std::string firstDuplicate;
+
+    inv.beginBulkLoad(static_cast<size_t>(header.itemCount));
+    try {
+        for (uint64_t i = 0; i < header.itemCount; ++i) {
+            const Record r = readRecord(records + i * RECORD_SIZE);
+            try {
+                if (inv.emplaceItem(r.id, std::string(text(r.name)), r.quantity, text(r.location), r.price,
+                                    text(r.currency), text(r.unit), text(r.category), std::string(text(r.sku))))
+                    ++added;
+                else if (duplicates++ == 0)
+                    firstDuplicate = "id " + std::to_string(r.id) + " in record " + std::to_string(i);
+            } catch (const std::invalid_argument &e) {
+                if (rejected++ < NAMED_REJECTS)
+                    rejectedNames += (rejected > 1 ? "; id " : "id ") + std::to_string(r.id) + " in record " + std::to_string(i) + ": " + e.what();
+            }
+        }
+    } catch (...) {
+        inv.endBulkLoad();
+        throw;
+    }
+    inv.endBulkLoad();
+
+    if (duplicates)
+        OutputFormatter::printWarning("Skipped " + std::to_string(duplicates) + " duplicate snapshot record(s) (ID or SKU already in use); first: " + firstDuplicate);
+    if (rejected) {
+        if (rejected > NAMED_REJECTS) rejectedNames += "; and " + std::to_string(rejected - NAMED_REJECTS) + " more";
+        return Result<size_t>::fail(std::to_string(rejected) + " invalid snapshot record(s): " + rejectedNames);
+    }
+    return Result<size_t>::success(added);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+//Included files
+#include "Inventory.h"
+#include "results.hpp"
+
+//Needed libraries
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Which file a checkpoint writes and startup reads first
+enum class SnapshotFormat { Binary, Json };
+
+// Versioned binary inventory snapshot (`<data file>.snap`).
+//
+// Layout (little-endian; offsets are from the start of the file):
+//   Header   64 bytes: magic, version, record size, item count, section
+//            offsets and a 64-bit murmur-style checksum of everything
+//            after the header
+//   Records  itemCount fixed 64-byte records, one per item
+//   Heap     string bytes; records point into it by (offset, length).
+//            Interned fields (location, currency, unit, category) are
+//            stored once per distinct value.
+//
+// Loading maps the file and builds items straight from the records, so
+// nothing is tokenized or unescaped, then builds the indexes in bulk. A
+// bad magic, a newer version, a size mismatch or a checksum failure
+// rejects the whole file before any item is added. As in
+// Inventory::fromJSON, records that fail validation fail the load and
+// records that repeat an ID/SKU are skipped with a warning.
+class Snapshot {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    static Result<std::string> encode(const Inventory &inv);                 // Whole file image
+    static Result<size_t> decode(std::string_view image, Inventory &inv);   // Items added
+
+    static uint64_t checksum(std::string_view bytes);
+};
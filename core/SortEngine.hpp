@@ -0,0 +1,181 @@
+#pragma once
+
+//Needed libraries
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Sorts compact (key, id, ref) rows instead of whole items; `ref` is the
+// caller's handle back to the item (e.g. an index into an ItemView).
+// Ties on the key are broken by ID, and descending order is the exact
+// reverse of ascending, so results match a reverse walk of an ordered index.
+//
+//  - Integer keys: LSD radix sort over (key, id) packed into 64 bits
+//  - Text keys:    rows carry the first 8 bytes as a big-endian integer, so
+//                  most comparisons never touch the string itself
+//  - Large inputs are split across hardware threads and merged pairwise
+//
+// Direction is a template parameter, so the inner loops never branch on it.
+class SortEngine {
+public:
+    struct IntRow {
+        uint64_t key;   // (key, id), sign-flipped so unsigned order == signed order
+        uint32_t ref;
+    };
+
+    struct TextRow {
+        uint64_t prefix;
+        std::string_view text;   // Must outlive the sort
+        int32_t id;
+        uint32_t ref;
+    };
+
+    static constexpr size_t PARALLEL_THRESHOLD = 1u << 16;   // Rows per thread, at least
+
+    static IntRow intRow(int32_t key, int32_t id, uint32_t ref) {
+        const uint64_t hi = static_cast<uint32_t>(key) ^ 0x80000000u;
+        const uint64_t lo = static_cast<uint32_t>(id) ^ 0x80000000u;
+        return IntRow{(hi << 32) | lo, ref};
+    }
+
+    static TextRow textRow(std::string_view text, int32_t id, uint32_t ref) {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            prefix <<= 8;
+            if (i < text.size()) prefix |= static_cast<unsigned char>(text[i]);
+        }
+        return TextRow{prefix, text, id, ref};
+    }
+
+    template<bool Ascending>
+    static void sort(std::vector<IntRow> &rows) {
+        parallelSort(rows, [](IntRow *first, IntRow *last) { radixSort<Ascending>(first, last); },
+                     IntLess<Ascending>{});
+    }
+
+    template<bool Ascending>
+    static void sort(std::vector<TextRow> &rows) {
+        parallelSort(rows, [](TextRow *first, TextRow *last) { std::sort(first, last, TextLess<Ascending>{}); },
+                     TextLess<Ascending>{});
+    }
+
+private:
+    template<bool Ascending>
+    struct IntLess {
+        bool operator()(const IntRow &a, const IntRow &b) const {
+            return Ascending ? a.key < b.key : a.key > b.key;
+        }
+    };
+
+    template<bool Ascending>
+    struct TextLess {
+        bool operator()(const TextRow &a, const TextRow &b) const {
+            return Ascending ? before(a, b) : before(b, a);
+        }
+        static bool before(const TextRow &a, const TextRow &b) {
+            if (a.prefix != b.prefix) return a.prefix < b.prefix;
+            // Same first 8 bytes; only now compare the tails
+            if (a.text.size() > 8 || b.text.size() > 8) {
+                int cmp = a.text.compare(b.text);
+                if (cmp != 0) return cmp < 0;
+            } else if (a.text.size() != b.text.size()) {
+                return a.text.size() < b.text.size();
+            }
+            return a.id < b.id;
+        }
+    };
+
+    // 8-bit digits; a pass whose digit is the same for every row is skipped,
+    // which drops most of the high-order passes for small keys and IDs
+    template<bool Ascending>
+    static void radixSort(IntRow *first, IntRow *last) {
+        const size_t n = static_cast<size_t>(last - first);
+        if (n < 2) return;
+        if (n < 64) {
+            std::sort(first, last, IntLess<Ascending>{});
+            return;
+        }
+
+        std::vector<IntRow> scratch(n);
+        IntRow *src = first;
+        IntRow *dst = scratch.data();
+
+        for (unsigned shift = 0; shift < 64; shift += 8) {
+            size_t counts[256] = {};
+            for (size_t i = 0; i < n; ++i) ++counts[digit<Ascending>(src[i].key, shift)];
+            if (counts[digit<Ascending>(src[0].key, shift)] == n) continue;
+
+            size_t offset = 0;
+            for (size_t &c : counts) {
+                size_t here = c;
+                c = offset;
+                offset += here;
+            }
+            for (size_t i = 0; i < n; ++i) dst[counts[digit<Ascending>(src[i].key, shift)]++] = src[i];
+            std::swap(src, dst);
+        }
+
+        if (src != first) std::memcpy(first, src, n * sizeof(IntRow));
+    }
+
+    template<bool Ascending>
+    static unsigned digit(uint64_t key, unsigned shift) {
+        return static_cast<unsigned>(((Ascending ? key : ~key) >> shift) & 0xFF);
+    }
+
+    // Sort contiguous chunks on separate threads, then merge neighbours
+    // (also in parallel) until one run remains
+    template<typename Row, typename SortChunk, typename Less>
+    static void parallelSort(std::vector<Row> &rows, SortChunk sortChunk, Less less) {
+        const size_t n = rows.size();
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min(threads, n / PARALLEL_THRESHOLD);
+        if (threads < 2) {
+            sortChunk(rows.data(), rows.data() + n);
+            return;
+        }
+
+        std::vector<size_t> bounds;
+        for (size_t t = 0; t <= threads; ++t) bounds.push_back(n * t / threads);
+
+        runEach(threads, [&](size_t t) {
+            sortChunk(rows.data() + bounds[t], rows.data() + bounds[t + 1]);
+        });
+
+        std::vector<Row> scratch(n);
+        std::vector<Row> *src = &rows;
+        std::vector<Row> *dst = &scratch;
+        while (bounds.size() > 2) {
+            const size_t runs = bounds.size() - 1;
+            std::vector<size_t> merged;
+            for (size_t r = 0; r < runs; r += 2) merged.push_back(bounds[r]);
+            merged.push_back(n);
+
+            runEach((runs + 1) / 2, [&](size_t m) {
+                const size_t lo = bounds[2 * m];
+                const size_t mid = bounds[std::min(2 * m + 1, runs)];
+                const size_t hi = bounds[std::min(2 * m + 2, runs)];
+                std::merge(src->begin() + lo, src->begin() + mid,
+                           src->begin() + mid, src->begin() + hi,
+                           dst->begin() + lo, less);
+            });
+
+            std::swap(src, dst);
+            bounds.swap(merged);
+        }
+
+        if (src != &rows) rows.swap(scratch);
+    }
+
+    template<typename Job>
+    static void runEach(size_t count, Job job) {
+        std::vector<std::thread> workers;
+        workers.reserve(count - 1);
+        for (size_t i = 1; i < count; ++i) workers.emplace_back(job, i);
+        job(0);
+        for (auto &w : workers) w.join();
+    }
+};
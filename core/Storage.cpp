@@ -2,10 +2,47 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 namespace fs = std::filesystem;
 
+// ─────────────────────────────────────────────
+// Sync helpers
+// ─────────────────────────────────────────────
+// Pushes a stream's buffered data to the device, not just to the OS
+static bool syncStream(FILE* f) {
+    if (fflush(f) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(f)) == 0;
+#else
+    return fsync(fileno(f)) == 0;
+#endif
+}
+
+// Makes a rename inside `file`'s directory durable
+static bool syncDirectory(const string& file) {
+#ifdef _WIN32
+    (void)file;   // NTFS journals the rename; directories cannot be flushed
+    return true;
+#else
+    fs::path dir = fs::path(file).parent_path();
+    if (dir.empty()) dir = ".";
+    int fd = open(dir.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    const bool ok = fsync(fd) == 0;
+    close(fd);
+    return ok;
+#endif
+}
+
 // ─────────────────────────────────────────────
 // Constructor
 // ─────────────────────────────────────────────
@@ -54,21 +91,23 @@ optional<StorageError> Storage::initializeStorage() const {
 // ─────────────────────────────────────────────
 // Atomic write
 // ─────────────────────────────────────────────
-optional<StorageError> Storage::atomicWrite(const string& content) const {
+optional<StorageError> Storage::atomicWrite(const string& content, bool sync, bool backup) const {
     string err;
     if (!validatePath(err))
         return StorageError(err);
 
-    if (!createBackup(err))
+    if (backup && !createBackup(err))
         return StorageError(err);
 
     string tempFile = dataFilePath + ".tmp";
 
-    ofstream out(tempFile);
+    FILE* out = fopen(tempFile.c_str(), "wb");   // Binary: snapshots are not text
     if (!out) return StorageError("Failed to open temp file");
 
-    out << content;
-    out.close();
+    const bool written = fwrite(content.data(), 1, content.size(), out) == content.size();
+    const bool synced = !sync || syncStream(out);
+    if (fclose(out) != 0 || !written) return StorageError("Failed to write temp file");
+    if (!synced) return StorageError("Failed to sync temp file");
 
     try {
         fs::rename(tempFile, dataFilePath);
@@ -76,17 +115,24 @@ optional<StorageError> Storage::atomicWrite(const string& content) const {
         return StorageError("Atomic rename failed");
     }
 
+    if (sync && !syncDirectory(dataFilePath)) return StorageError("Failed to sync data directory");
     return nullopt;
 }
 
 // ─────────────────────────────────────────────
 // Append
 // ─────────────────────────────────────────────
-optional<StorageError> Storage::append(const string& content, bool newline) const {
-    ofstream out(dataFilePath, ios::app);
+optional<StorageError> Storage::append(const string& content, bool newline, bool sync) const {
+    FILE* out = fopen(dataFilePath.c_str(), "a");
     if (!out) return StorageError("Append failed");
-    out << content;
-    if (newline) out << "\n";
+
+    bool ok = fwrite(content.data(), 1, content.size(), out) == content.size();
+    if (ok && newline) ok = fputc('\n', out) != EOF;
+    if (ok && sync && !syncStream(out)) {
+        fclose(out);
+        return StorageError("Failed to sync appended data");
+    }
+    if (fclose(out) != 0 || !ok) return StorageError("Append failed");
     return nullopt;
 }
 
@@ -122,9 +168,11 @@ vector<string> Storage::readLines(string& err) const {
 // ─────────────────────────────────────────────
 // Clear
 // ─────────────────────────────────────────────
-optional<StorageError> Storage::clear() const {
-    ofstream out(dataFilePath, ios::trunc);
+optional<StorageError> Storage::clear(bool sync) const {
+    FILE* out = fopen(dataFilePath.c_str(), "w");
     if (!out) return StorageError("Failed to clear file");
+    const bool synced = !sync || syncStream(out);
+    if (fclose(out) != 0 || !synced) return StorageError("Failed to clear file");
     return nullopt;
 }
 
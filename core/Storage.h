@@ -10,6 +10,13 @@ public:
     explicit StorageError(const std::string& msg) : message(msg) {}
 };
 
+// How far a write is pushed before it counts as saved
+enum class Durability {
+    None,     // Left to the OS page cache (fast; lost on power failure)
+    Commit,   // fsync on every commit
+    Group     // Concurrent commits share one fsync (see MutationJournal)
+};
+
 class Storage {
 private:
     std::string dataFilePath;
@@ -22,12 +29,15 @@ public:
     explicit Storage(const std::string& filePath);
 
     std::optional<StorageError> initializeStorage() const;       // Create file if not exists
-    std::optional<StorageError> atomicWrite(const std::string& content) const;    // Atomic write to prevent corruption
-    std::optional<StorageError> append(const std::string& content, bool newline = true) const;  // Append data
+    // `sync` fsyncs the data (and, for atomicWrite, the directory entry of
+    // the rename) before returning. `backup` first copies the current file
+    // to <file>.bak.
+    std::optional<StorageError> atomicWrite(const std::string& content, bool sync = false, bool backup = true) const;    // Atomic write to prevent corruption
+    std::optional<StorageError> append(const std::string& content, bool newline = true, bool sync = false) const;  // Append data
 
     std::optional<std::string> readAll(std::string& err) const;   // Read entire file content
     std::vector<std::string> readLines(std::string& err) const;   // Read file line by line
 
-    std::optional<StorageError> clear() const;    // Clear file content
+    std::optional<StorageError> clear(bool sync = false) const;    // Clear file content
     std::string getFilePath() const;
 };
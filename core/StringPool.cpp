@@ -0,0 +1,110 @@
+//Included files
+#include "StringPool.h"
+
+//Needed libraries
+#include <unordered_map>
+#include <stdexcept>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// ─────────────────────────────────────────────
+// Storage
+// ─────────────────────────────────────────────
+// Strings live in fixed-size blocks reached through a fixed table of block
+// pointers, so growing the pool never moves a string or the table itself.
+namespace {
+    constexpr size_t BLOCK_BITS = 12;
+    constexpr size_t BLOCK_SIZE = size_t(1) << BLOCK_BITS;   // Strings per block
+    constexpr size_t MAX_BLOCKS = 4096;                      // 16M distinct strings
+    constexpr size_t RECENT_LIMIT = 4096;                    // Per-thread intern cache entries
+
+    struct Pool {
+        std::atomic<std::string*> blocks[MAX_BLOCKS] = {};
+        std::atomic<size_t> count{0};
+        size_t bytes = 0;
+
+        std::unordered_map<std::string_view, Symbol> index;   // Views into the blocks
+        std::mutex writeLock;
+
+        ~Pool() {
+            for (auto &block : blocks) delete[] block.load();
+        }
+    };
+
+    Pool &pool() {
+        static Pool instance;
+        return instance;
+    }
+}
+
+// ─────────────────────────────────────────────
+// Interning
+// ─────────────────────────────────────────────
+Symbol StringPool::intern(std::string_view text) {
+    // Per-thread cache of recent hits, so threads building items in
+    // parallel do not queue on the lock for values they have seen.
+    // Keys view pool strings, which never move.
+    thread_local std::unordered_map<std::string_view, Symbol> recent;
+    auto hit = recent.find(text);
+    if (hit != recent.end()) return hit->second;
+    if (recent.size() >= RECENT_LIMIT) recent.clear();
+
+    Pool &p = pool();
+    std::lock_guard<std::mutex> guard(p.writeLock);
+
+    auto it = p.index.find(text);
+    if (it != p.index.end()) {
+        recent.emplace(it->first, it->second);
+        return it->second;
+    }
+
+    const size_t n = p.count.load(std::memory_order_relaxed);
+    const size_t blockNo = n >> BLOCK_BITS;
+    if (blockNo >= MAX_BLOCKS) throw std::length_error("String pool is full");
+
+    std::string *block = p.blocks[blockNo].load(std::memory_order_relaxed);
+    if (!block) {
+        block = new std::string[BLOCK_SIZE];
+        p.blocks[blockNo].store(block, std::memory_order_release);
+    }
+
+    std::string &slot = block[n & (BLOCK_SIZE - 1)];
+    slot.assign(text.data(), text.size());
+    p.bytes += slot.capacity() > 15 ? slot.capacity() + 1 : 0;
+
+    const Symbol sym = static_cast<Symbol>(n);
+    p.index.emplace(std::string_view(slot), sym);
+    p.count.store(n + 1, std::memory_order_release);
+    recent.emplace(std::string_view(slot), sym);
+    return sym;
+}
+
+std::optional<Symbol> StringPool::lookup(std::string_view text) {
+    Pool &p = pool();
+    std::lock_guard<std::mutex> guard(p.writeLock);
+    auto it = p.index.find(text);
+    if (it == p.index.end()) return std::nullopt;
+    return it->second;
+}
+
+const std::string& StringPool::str(Symbol sym) {
+    Pool &p = pool();
+    if (sym >= p.count.load(std::memory_order_acquire)) throw std::out_of_range("Unknown string symbol");
+    return p.blocks[sym >> BLOCK_BITS].load(std::memory_order_acquire)[sym & (BLOCK_SIZE - 1)];
+}
+
+// ─────────────────────────────────────────────
+// Stats
+// ─────────────────────────────────────────────
+size_t StringPool::size() {
+    return pool().count.load(std::memory_order_acquire);
+}
+
+size_t StringPool::bytesUsed() {
+    Pool &p = pool();
+    std::lock_guard<std::mutex> guard(p.writeLock);
+    const size_t blocks = (p.count.load() + BLOCK_SIZE - 1) >> BLOCK_BITS;
+    return blocks * BLOCK_SIZE * sizeof(std::string) + p.bytes
+         + p.index.size() * (sizeof(std::string_view) + sizeof(Symbol) + 2 * sizeof(void*));
+}
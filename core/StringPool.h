@@ -0,0 +1,28 @@
+#pragma once
+
+//Needed libraries
+#include <string_view>
+#include <optional>
+#include <cstdint>
+#include <string>
+
+// Small integer handle for an interned string
+using Symbol = uint32_t;
+
+// Process-wide, append-only table of interned strings.
+//
+// Low-cardinality fields (locations, currencies, units, categories) are
+// stored as Symbols, so each distinct value exists once and equality is
+// an integer compare. Strings are never removed, so references returned
+// by str() stay valid for the life of the process. intern() only takes
+// the lock for strings the calling thread has not interned recently;
+// str() is lock-free and safe to call while others intern.
+class StringPool {
+public:
+    static Symbol intern(std::string_view text);
+    static std::optional<Symbol> lookup(std::string_view text);   // Does not insert
+    static const std::string& str(Symbol sym);
+
+    static size_t size();          // Distinct strings
+    static size_t bytesUsed();     // Approximate heap held by the pool
+};
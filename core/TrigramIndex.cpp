@@ -0,0 +1,185 @@
+//Included files
+#include "TrigramIndex.h"
+
+//Needed libraries
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+
+// -----------------------------
+// Helpers
+// -----------------------------
+uint32_t TrigramIndex::pack(unsigned char a, unsigned char b, unsigned char c) {
+    return (static_cast<uint32_t>(a) << 16) | (static_cast<uint32_t>(b) << 8) | c;
+}
+
+std::string TrigramIndex::fold(const std::string &text) {
+    std::string out(text);
+    std::transform(out.begin(), out.end(), out.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return out;
+}
+
+std::vector<uint32_t> TrigramIndex::trigramsOf(const std::string &text) {
+    std::vector<uint32_t> grams;
+    if (text.size() < MIN_QUERY) return grams;
+
+    std::string folded = fold(text);
+    grams.reserve(folded.size() - 2);
+    for (size_t i = 0; i + 2 < folded.size(); ++i) {
+        grams.push_back(pack(folded[i], folded[i + 1], folded[i + 2]));
+    }
+
+    // A name like "aaaa" repeats trigrams; keep each once
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+// -----------------------------
+// Posting sets
+// -----------------------------
+size_t TrigramIndex::PostingSet::home(int id) const {
+    return static_cast<size_t>((static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ull) >> shift);   // Fibonacci hashing
+}
+
+void TrigramIndex::PostingSet::rehash(size_t capacity) {
+    unsigned bits = 3;
+    while ((size_t(1) << bits) < capacity) ++bits;
+
+    std::vector<int> old(size_t(1) << bits, EMPTY);
+    old.swap(slots);
+    shift = 64 - bits;
+    const size_t mask = slots.size() - 1;
+    for (int id : old) {
+        if (id == EMPTY) continue;
+        size_t i = home(id);
+        while (slots[i] != EMPTY) i = (i + 1) & mask;
+        slots[i] = id;
+    }
+}
+
+void TrigramIndex::PostingSet::reserve(size_t n) {
+    if (2 * n > slots.size()) rehash(2 * n);
+}
+
+bool TrigramIndex::PostingSet::insert(int id) {
+    if (2 * (count + 1) > slots.size()) rehash(2 * (count + 1));
+    const size_t mask = slots.size() - 1;
+    size_t i = home(id);
+    for (; slots[i] != EMPTY; i = (i + 1) & mask) {
+        if (slots[i] == id) return false;
+    }
+    slots[i] = id;
+    ++count;
+    return true;
+}
+
+bool TrigramIndex::PostingSet::contains(int id) const {
+    if (slots.empty()) return false;
+    const size_t mask = slots.size() - 1;
+    for (size_t i = home(id); slots[i] != EMPTY; i = (i + 1) & mask) {
+        if (slots[i] == id) return true;
+    }
+    return false;
+}
+
+bool TrigramIndex::PostingSet::erase(int id) {
+    if (slots.empty()) return false;
+    const size_t mask = slots.size() - 1;
+    size_t i = home(id);
+    for (; slots[i] != id; i = (i + 1) & mask) {
+        if (slots[i] == EMPTY) return false;
+    }
+
+    // Backward shift: pull later entries of the probe run into the hole
+    // unless their home lies cyclically in (hole, j]
+    for (size_t j = (i + 1) & mask; slots[j] != EMPTY; j = (j + 1) & mask) {
+        const size_t h = home(slots[j]);
+        const bool stays = (i <= j) ? (i < h && h <= j) : (i < h || h <= j);
+        if (stays) continue;
+        slots[i] = slots[j];
+        i = j;
+    }
+    slots[i] = EMPTY;
+    --count;
+    return true;
+}
+
+// -----------------------------
+// Maintenance
+// -----------------------------
+void TrigramIndex::insert(int id, const std::string &name) {
+    for (uint32_t g : trigramsOf(name)) postings[g].insert(id);
+}
+
+// Counts each trigram's postings first so every set is sized once,
+// instead of rehashing its way up one insert at a time
+void TrigramIndex::insertMany(const std::vector<std::pair<int, const std::string*>> &names) {
+    std::unordered_map<uint32_t, size_t> counts;
+    for (const auto &entry : names) {
+        for (uint32_t g : trigramsOf(*entry.second)) ++counts[g];
+    }
+    postings.reserve(postings.size() + counts.size());
+    for (const auto &[g, n] : counts) {
+        auto &ids = postings[g];
+        ids.reserve(ids.size() + n);
+    }
+
+    for (const auto &[id, name] : names) {
+        for (uint32_t g : trigramsOf(*name)) postings[g].insert(id);
+    }
+}
+
+void TrigramIndex::erase(int id, const std::string &name) {
+    for (uint32_t g : trigramsOf(name)) {
+        auto it = postings.find(g);
+        if (it == postings.end()) continue;
+        it->second.erase(id);
+        if (it->second.empty()) postings.erase(it);
+    }
+}
+
+// -----------------------------
+// Lookup
+// -----------------------------
+bool TrigramIndex::candidates(const std::string &query, std::vector<int> &out) const {
+    out.clear();
+    std::vector<uint32_t> grams = trigramsOf(query);
+    if (grams.empty()) return false;
+
+    std::vector<const PostingSet*> lists;
+    lists.reserve(grams.size());
+    for (uint32_t g : grams) {
+        auto it = postings.find(g);
+        if (it == postings.end()) return true;   // A missing trigram means no match at all
+        lists.push_back(&it->second);
+    }
+
+    // Walk the shortest posting list and probe the others
+    std::sort(lists.begin(), lists.end(),
+        [](const auto *a, const auto *b) { return a->size() < b->size(); });
+
+    out.reserve(lists.front()->size());
+    lists.front()->forEach([&](int id) {
+        bool inAll = true;
+        for (size_t i = 1; i < lists.size() && inAll; ++i) {
+            inAll = lists[i]->contains(id);
+        }
+        if (inAll) out.push_back(id);
+    });
+    return true;
+}
+
+size_t TrigramIndex::estimate(const std::string &query) const {
+    std::vector<uint32_t> grams = trigramsOf(query);
+    if (grams.empty()) return SIZE_MAX;
+
+    size_t best = SIZE_MAX;
+    for (uint32_t g : grams) {
+        auto it = postings.find(g);
+        if (it == postings.end()) return 0;
+        best = std::min(best, it->second.size());
+    }
+    return best;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+//Needed libraries
+#include <unordered_map>
+#include <cstdint>
+#include <utility>
+#include <string>
+#include <vector>
+
+// Inverted index from 3-byte name fragments to item IDs.
+// Names are case-folded before indexing, so one index serves both
+// case-sensitive and case-insensitive searches: it only narrows the
+// candidate set, and the caller verifies each candidate against the real name.
+class TrigramIndex {
+private:
+    // Open-addressing set of item IDs (IDs are non-negative, so -1 marks
+    // a free slot). Linear probing with backward-shift erase keeps each
+    // posting list in one flat array instead of a heap node per ID.
+    class PostingSet {
+    private:
+        static constexpr int EMPTY = -1;
+        std::vector<int> slots;   // Power-of-two size, at most half full
+        size_t count = 0;
+        unsigned shift = 64;      // 64 - log2(slots.size())
+
+        size_t home(int id) const;
+        void rehash(size_t capacity);
+
+    public:
+        bool insert(int id);
+        bool erase(int id);
+        bool contains(int id) const;
+        void reserve(size_t n);
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        template<typename Visit>
+        void forEach(Visit &&visit) const {
+            for (int id : slots) {
+                if (id != EMPTY) visit(id);
+            }
+        }
+    };
+
+    std::unordered_map<uint32_t, PostingSet> postings;   // Trigram -> IDs
+
+    static uint32_t pack(unsigned char a, unsigned char b, unsigned char c);
+    static std::vector<uint32_t> trigramsOf(const std::string &text);
+
+public:
+    static constexpr size_t MIN_QUERY = 3;   // Shorter queries cannot use the index
+
+    static std::string fold(const std::string &text);   // ASCII lower-case
+
+    void insert(int id, const std::string &name);
+    void erase(int id, const std::string &name);
+    void insertMany(const std::vector<std::pair<int, const std::string*>> &names);   // Bulk insert (id, name)
+    void clear() { postings.clear(); }
+
+    // Fills `out` with IDs whose name contains every trigram of `query`.
+    // Returns false if the query is too short, meaning the caller must scan.
+    bool candidates(const std::string &query, std::vector<int> &out) const;
+
+    // Upper bound on candidates (shortest posting list); SIZE_MAX if unindexable
+    size_t estimate(const std::string &query) const;
+};
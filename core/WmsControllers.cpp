@@ -1,12 +1,16 @@
 //needed file inclusion
 #include "WmsControllers.h"
+#include "MappedFile.h"
 #include "Item.h"
 
 //libraries
+#include <filesystem>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <random>
+#include <thread>
 #include <cctype>
 
 using namespace std;
@@ -15,7 +19,7 @@ using namespace std;
 // Constructor
 // ─────────────────────────────────────────────
 WmsControllers::WmsControllers(const string& storagePath)
-    : inventory(storagePath), storage(storagePath) {
+    : inventory(storagePath), storage(storagePath), snapshotStore(storagePath + ".snap"), journal(storagePath) {
 
     commandRegistry["ADD"]    = [this](const Task& t){ return cmdAdd(t); };
     commandRegistry["REMOVE"] = [this](const Task& t){ return cmdRemove(t); };
@@ -32,32 +36,157 @@ bool WmsControllers::initializeSystem() {
         return false;
     }
 
-    string e;
-    auto data = storage.readAll(e);
-    if (data) inventory.fromJSON(*data);
+    // A binary checkpoint, whatever the current format, is newer than the
+    // JSON file (JSON checkpoints delete it), so it is the only safe base
+    // for the journal. If it cannot be read, stop rather than roll back.
+    if (filesystem::exists(snapshotStore.getFilePath())) {
+        if (!loadBinarySnapshot()) return false;
+    } else {
+        // A partial load must not be checkpointed over the file
+        string e;
+        if (!loadJSON(storage.getFilePath(), e)) {
+            cerr << "[JSON] " << e << endl;
+            return false;
+        }
+    }
+
+    // Mutations made after that snapshot was written
+    string walErr;
+    const size_t replayed = journal.replay(inventory, walErr);
+    if (!walErr.empty()) {
+        cerr << "[JOURNAL] " << walErr << "; kept the " << replayed << " record(s) before it" << endl;
+        saveAll();   // New records must never follow the damaged tail
+    }
 
     return true;
 }
 
+bool WmsControllers::loadBinarySnapshot() {
+    const string& path = snapshotStore.getFilePath();
+    MappedFile map;
+    string err;
+    if (map.open(path, err)) {
+        auto loaded = Snapshot::decode(map.bytes(), inventory);
+        if (loaded.ok) return true;
+        err = loaded.error;
+    }
+    cerr << "[SNAPSHOT] " << path << ": " << err << endl;
+    cerr << "[SNAPSHOT] " << storage.getFilePath() << " may be older than this checkpoint;"
+         << " restore the snapshot, or delete it to start from the JSON file" << endl;
+    return false;
+}
+
+optional<size_t> WmsControllers::loadJSON(const string& path, string& err) {
+    MappedFile map;
+    if (!map.open(path, err)) return nullopt;
+
+    const size_t threads = loadThreads ? loadThreads : max(1u, thread::hardware_concurrency());
+    auto loaded = inventory.fromJSON(map.bytes(), threads);
+    if (!loaded.ok) {
+        err = path + ": " + loaded.error;
+        return nullopt;
+    }
+    return loaded.value;
+}
+
 void WmsControllers::saveAll() {
-    storage.atomicWrite(inventory.toJSON());
+    const bool sync = journal.durability() != Durability::None;
+    // With the journal on, the old checkpoint plus the journal cover every
+    // change until the rename, so a .bak copy of the whole file on every
+    // checkpoint buys nothing
+    const bool backup = !journaling;
+    optional<StorageError> err;
+    if (snapshotFormat == SnapshotFormat::Binary) {
+        auto image = Snapshot::encode(inventory);
+        if (image.ok) err = snapshotStore.atomicWrite(image.value, sync, backup);
+        else err = StorageError(image.error);
+    } else {
+        err = storage.atomicWrite(inventory.toJSON(), sync, backup);
+        if (!err) {
+            // The JSON file is the newest state now; a leftover binary
+            // checkpoint would win at the next startup
+            error_code ec;
+            filesystem::remove(snapshotStore.getFilePath(), ec);   // No file is not an error
+            if (ec) err = StorageError("Cannot remove stale snapshot " + snapshotStore.getFilePath() + ": " + ec.message());
+        }
+    }
+
+    if (err) {
+        cerr << "[STORAGE ERROR] " << err.value().message << endl;
+        return;   // Keep the journal: it is still the only copy of recent changes
+    }
+    if (auto jerr = journal.reset())
+        cerr << "[JOURNAL] " << jerr.value().message << endl;
+}
+
+void WmsControllers::setSnapshotFormat(SnapshotFormat format) {
+    snapshotFormat = format;
+}
+
+void WmsControllers::setLoadThreads(size_t threads) {
+    loadThreads = threads;
 }
 
-bool WmsControllers::addItem(int id, const string& name, int qty, const string& loc) {
+optional<StorageError> WmsControllers::exportJSON(const string& path) const {
+    return Storage(path).atomicWrite(inventory.toJSON());
+}
+
+optional<size_t> WmsControllers::importJSON(const string& path, string& err) {
+    return loadJSON(path, err);
+}
+
+void WmsControllers::enableJournal(bool on) {
+    journaling = on;
+}
+
+void WmsControllers::setDurability(Durability mode, std::chrono::microseconds groupWindow) {
+    journal.setDurability(mode, groupWindow);
+}
+
+void WmsControllers::commit() {
+    if (!journaling) {
+        saveAll();
+        return;
+    }
+
+    if (auto err = journal.flush()) {
+        cerr << "[JOURNAL] " << err.value().message << "; writing a full snapshot instead" << endl;
+        saveAll();
+        return;
+    }
+    if (journal.size() >= std::max(CHECKPOINT_MIN_RECORDS, inventory.totalItems() / 2)) saveAll();
+}
+
+bool WmsControllers::addItem(int id, string name, int qty, const string& loc, string sku) {
     if (qty < 0) return false;
+    if (!Item::isValidLocation(loc)) return false;
     if (inventory.findItem(id)) return false;
 
-    Item item(id, name, qty, loc);
-    return inventory.addItem(item);
+    if (!inventory.emplaceItem(id, std::move(name), qty, loc, 0.0, "EGP", "pcs", "general", std::move(sku)))
+        return false;
+    if (journaling) journal.recordAdd(*inventory.findItem(id));
+    return true;
 }
 
 bool WmsControllers::removeItem(int id) {
     if (!inventory.findItem(id)) return false;
-    return inventory.removeItem(id);
+    if (!inventory.removeItem(id)) return false;
+    if (journaling) journal.recordRemove(id);
+    return true;
 }
 
-void WmsControllers::listItems(size_t page, size_t pageSize) {
-    inventory.displayItems(page, pageSize);
+bool WmsControllers::adjustQuantity(int id, int delta) {
+    if (!inventory.changeQuantity(id, delta)) return false;
+    if (journaling) journal.recordQuantity(id, inventory.findItem(id)->getQuantity());
+    return true;
+}
+
+void WmsControllers::listItems(size_t page, size_t pageSize, std::pmr::memory_resource* scratch) {
+    inventory.displayItems(page, pageSize, scratch);
+}
+
+bool WmsControllers::listItemsAfter(const string& cursor, size_t pageSize, std::pmr::memory_resource* scratch) {
+    return inventory.displayItemsAfter(cursor, pageSize, scratch);
 }
 
 std::optional<Item> WmsControllers::getItem(int id) {
@@ -65,6 +194,106 @@ std::optional<Item> WmsControllers::getItem(int id) {
     return std::nullopt;
 }
 
+const Item* WmsControllers::viewItem(int id) const {
+    return inventory.findItem(id);
+}
+
+const Item* WmsControllers::viewBySku(const string& sku) const {
+    return inventory.findBySku(sku);
+}
+
+ItemView WmsControllers::findByName(const string& query, bool caseInsensitive) const {
+    return inventory.viewByName(query, caseInsensitive);
+}
+
+std::vector<std::string> WmsControllers::completeNames(const string& prefix, size_t limit) const {
+    return inventory.completeName(prefix, limit);
+}
+
+std::vector<int> WmsControllers::completeIds(const string& prefix, size_t limit) const {
+    return inventory.completeId(prefix, limit);
+}
+
+ItemView WmsControllers::itemsUnder(const LocationCode& area) const {
+    return inventory.viewUnderLocation(area);
+}
+
+std::map<uint16_t, size_t> WmsControllers::locationBreakdown(const LocationCode& area) const {
+    return inventory.locationBreakdown(area);
+}
+
+ItemView WmsControllers::lowestStock(size_t k) const {
+    return inventory.lowestStock(k);
+}
+
+ItemView WmsControllers::highestStock(size_t k) const {
+    return inventory.highestStock(k);
+}
+
+ItemView WmsControllers::highestValue(size_t k) const {
+    return inventory.highestValue(k);
+}
+
+ItemView WmsControllers::belowReorderPoint(int reorderPoint, size_t limit) const {
+    return inventory.belowReorderPoint(reorderPoint, limit);
+}
+
+bool WmsControllers::setReorderPoint(int id, int threshold) {
+    return inventory.setReorderPoint(id, threshold);
+}
+
+void WmsControllers::clearReorderPoint(int id) {
+    inventory.clearReorderPoint(id);
+}
+
+void WmsControllers::setCategoryReorderPoint(const string& category, int threshold) {
+    inventory.setCategoryReorderPoint(category, threshold);
+}
+
+std::vector<ReorderEvent> WmsControllers::drainReorderEvents(size_t max) {
+    return inventory.drainReorderEvents(max);
+}
+
+size_t WmsControllers::pendingReorderEvents() const {
+    return inventory.pendingReorderEvents();
+}
+
+const StockTotals& WmsControllers::stats() const {
+    return inventory.stockTotals();
+}
+
+std::vector<std::pair<std::string, StockTotals>> WmsControllers::statsByLocation() const {
+    return inventory.totalsByLocation();
+}
+
+std::vector<std::pair<std::string, StockTotals>> WmsControllers::statsByCategory() const {
+    return inventory.totalsByCategory();
+}
+
+SlabStats WmsControllers::storageStats() const {
+    return inventory.storageStats();
+}
+
+bool WmsControllers::denseIdIndex() const {
+    return inventory.denseIdIndex();
+}
+
+QueryPlan WmsControllers::explainQuery(const Query& q) const {
+    return QueryEngine(inventory).plan(q);
+}
+
+size_t WmsControllers::runQuery(const Query& q, const ItemVisitor& sink, std::pmr::memory_resource* scratch) const {
+    return QueryEngine(inventory).run(q, sink, scratch);
+}
+
+std::vector<AuditRecord> WmsControllers::auditForItem(int id) const {
+    return AuditJournal::global().forItem(id);
+}
+
+std::vector<AuditRecord> WmsControllers::auditSince(std::time_t from) const {
+    return AuditJournal::global().between(from, std::time(nullptr));
+}
+
 // ─────────────────────────────────────────────
 // Task ID generator
 // ─────────────────────────────────────────────
@@ -131,8 +360,10 @@ bool WmsControllers::cmdAdd(const Task& t) {
 
     int id=stoi(t.params[0]), qty=stoi(t.params[2]);
     if (qty<0 || inventory.findItem(id)) return false;
+    if (!Item::isValidLocation(t.params[3])) return false;
 
-    inventory.addItem({id,t.params[1],qty,t.params[3]});
+    if (!inventory.emplaceItem(id,t.params[1],qty,t.params[3])) return false;
+    if (journaling) journal.recordAdd(*inventory.findItem(id));
     return true;
 }
 
@@ -141,6 +372,7 @@ bool WmsControllers::cmdRemove(const Task& t) {
     int id=stoi(t.params[0]);
     if (!inventory.findItem(id)) return false;
     inventory.removeItem(id);
+    if (journaling) journal.recordRemove(id);
     return true;
 }
 
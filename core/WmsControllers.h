@@ -1,11 +1,16 @@
 #pragma once
 //needed file inclusion
+#include "MutationJournal.h"
+#include "Snapshot.h"
+#include "AuditJournal.h"
 #include "Inventory.h"
+#include "Query.h"
 #include "Storage.h"
 #include "Receipt.h"
 
 //needed libraries
 #include <unordered_map>
+#include <map>
 #include <functional>
 #include <optional>
 #include <chrono>
@@ -31,13 +36,20 @@ struct Task {
 class WmsControllers {
 private:
     Inventory inventory;
-    Storage storage;
+    Storage storage;           // JSON data file (import/export, legacy snapshots)
+    Storage snapshotStore;     // Binary checkpoint, `<data file>.snap`
+    SnapshotFormat snapshotFormat = SnapshotFormat::Binary;
+    size_t loadThreads = 0;    // JSON load threads; 0 = one per core
+    MutationJournal journal;   // Mutations since the last snapshot
+    bool journaling = false;
     std::priority_queue<Task> taskQueue;
 
     std::unordered_map<std::string,
         std::function<bool(const Task&)>> commandRegistry;
 
     // Helpers
+    bool loadBinarySnapshot();   // false (reported) if the .snap cannot be read
+    std::optional<size_t> loadJSON(const std::string& path, std::string& err);   // Maps and streams the file
     std::string generateTaskId() const;
     std::vector<std::string> smartSplit(const std::string& input);
     bool isNumeric(const std::string& s);
@@ -51,14 +63,72 @@ private:
 public:
     explicit WmsControllers(const std::string& storagePath);
 
-    bool initializeSystem();
-    void saveAll();
+    // Checkpoint once the journal holds half as many records as there are
+    // items (never below this), so snapshot cost amortizes to O(1) per mutation
+    static constexpr size_t CHECKPOINT_MIN_RECORDS = 4096;
 
-    bool addItem(int id, const std::string& name, int qty, const std::string& loc);
+    bool initializeSystem();   // Loads the snapshot, then replays the journal; false on an unreadable .snap
+    void saveAll();            // Full snapshot (checkpoint); truncates the journal
+    void setSnapshotFormat(SnapshotFormat format);
+    void setLoadThreads(size_t threads);   // 0 = one per core, 1 = serial
+
+    // JSON interchange; import adds items whose id is not taken yet
+    std::optional<StorageError> exportJSON(const std::string& path) const;
+    std::optional<size_t> importJSON(const std::string& path, std::string& err);
+    void enableJournal(bool on);
+    // Journal commits and snapshots; `groupWindow` only applies to Group
+    void setDurability(Durability mode,
+                       std::chrono::microseconds groupWindow = MutationJournal::DEFAULT_GROUP_WINDOW);
+    void commit();             // Persists the last command's mutations (autosave)
+
+    bool addItem(int id, std::string name, int qty, const std::string& loc, std::string sku = "");
     bool removeItem(int id);
-    void listItems(size_t page = 0, size_t pageSize = 10);
+    bool adjustQuantity(int id, int delta);   // false if not found; throws on insufficient stock
+    void listItems(size_t page = 0, size_t pageSize = 10, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+    bool listItemsAfter(const std::string& cursor, size_t pageSize = 10,   // false on bad cursor
+                        std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
     std::optional<Item> getItem(int id);
 
+    // Zero-copy reads; valid until the item is removed (see ItemView)
+    const Item* viewItem(int id) const;
+    const Item* viewBySku(const std::string& sku) const;
+    ItemView findByName(const std::string& query, bool caseInsensitive = false) const;
+    std::vector<std::string> completeNames(const std::string& prefix, size_t limit = 10) const;
+    std::vector<int> completeIds(const std::string& prefix, size_t limit = 10) const;
+    ItemView itemsUnder(const LocationCode& area) const;                     // Location order
+    std::map<uint16_t, size_t> locationBreakdown(const LocationCode& area) const;   // Next level -> items
+
+    // Replenishment top-K (see Inventory::lowestStock and friends)
+    ItemView lowestStock(size_t k) const;
+    ItemView highestStock(size_t k) const;
+    ItemView highestValue(size_t k) const;
+    ItemView belowReorderPoint(int reorderPoint, size_t limit = SIZE_MAX) const;
+
+    // Reorder triggers (see Inventory::setReorderPoint)
+    bool setReorderPoint(int id, int threshold);
+    void clearReorderPoint(int id);
+    void setCategoryReorderPoint(const std::string& category, int threshold);
+    std::vector<ReorderEvent> drainReorderEvents(size_t max = SIZE_MAX);
+    size_t pendingReorderEvents() const;
+
+    // Maintained aggregates (O(1) / O(groups) to read)
+    const StockTotals& stats() const;
+    std::vector<std::pair<std::string, StockTotals>> statsByLocation() const;
+    std::vector<std::pair<std::string, StockTotals>> statsByCategory() const;
+
+    // Item storage diagnostics
+    SlabStats storageStats() const;
+    bool denseIdIndex() const;
+
+    // Ad-hoc queries planned against the inventory indexes
+    QueryPlan explainQuery(const Query& q) const;
+    size_t runQuery(const Query& q, const ItemVisitor& sink,
+                    std::pmr::memory_resource* scratch = std::pmr::get_default_resource()) const;
+
+    // Audit history (from the global AuditJournal)
+    std::vector<AuditRecord> auditForItem(int id) const;
+    std::vector<AuditRecord> auditSince(std::time_t from) const;
+
     void enqueueTask(const std::string& raw, TaskPriority prio = TaskPriority::NORMAL);
     void processTasks(size_t limit = 0); // limit=0 → all
 
@@ -4,12 +4,14 @@
 #include "CommandContext.hpp" // ← needed for CommandContext definition
 #include "safetyparse.hpp"
 #include "command.hpp"
+#include "LocationCode.h"
 #include "Receipt.h"
 #include "output.h"
 #include "Item.h"
 
 //needed libraries
 #include <optional>
+#include <iomanip>
 #include <sstream>
 #include <algorithm>
 #include <stdexcept>
@@ -18,20 +20,28 @@
 // Command to add an item
 class AddCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
-        if (a.size() < 4)
-            return Result<void>::fail("Usage: add <id> <name> <qty> <loc>");
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.size() < 4 || a.size() > 5)
+            return Result<void>::fail("Usage: add <id> <name> <qty> <loc> [sku]");
 
         auto id = safetyparse(a[0]);
         auto qty = safetyparse(a[2]);
         if (!id.ok || !qty.ok)
             return Result<void>::fail(id.ok ? qty.error : id.error);
 
-        //  Now expects WmsControllers::addItem(int, string, int, string)
-        if (!ctx.wms.addItem(id.value, a[1], qty.value, a[3]))
+        const std::string loc(a[3]);
+        if (!Item::isValidLocation(loc))
+            return Result<void>::fail("Invalid location: " + loc + " (expected ZONE-AISLE-RACK-BIN, e.g. B-07-03-12)");
+
+        const std::string sku = a.size() == 5 ? std::string(a[4]) : "";
+        if (!sku.empty() && ctx.wms.viewBySku(sku))
+            return Result<void>::fail("SKU already in use: " + sku);
+
+        //  Now expects WmsControllers::addItem(int, string, int, string, sku)
+        if (!ctx.wms.addItem(id.value, std::string(a[1]), qty.value, loc, sku))
             return Result<void>::fail("Item exists");
 
-        if (ctx.autosave) ctx.wms.saveAll();
+        if (ctx.autosave) ctx.wms.commit();
         return Result<void>::success();
     }
 };
@@ -39,7 +49,7 @@ public:
 //Command to remove an item
 class RemoveCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
         if (a.size() != 1)
             return Result<void>::fail("Usage: remove <id>");
 
@@ -49,7 +59,34 @@ public:
         // Now expects Wmscootroller::removeItem(id)
         if (!ctx.wms.removeItem(id.value)) return Result<void>::fail("Item not found");
 
-        if (ctx.autosave) ctx.wms.saveAll();
+        if (ctx.autosave) ctx.wms.commit();
+        return Result<void>::success();
+    }
+};
+
+//Command to change an item's stock by a signed delta
+class AdjustCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.size() != 2)
+            return Result<void>::fail("Usage: adjust <id> <delta>");
+
+        auto id = safetyparse(a[0]);
+        auto delta = safetyparse(a[1]);
+        if (!id.ok || !delta.ok)
+            return Result<void>::fail(id.ok ? delta.error : id.error);
+
+        try {
+            if (!ctx.wms.adjustQuantity(id.value, delta.value))
+                return Result<void>::fail("Item not found");
+        } catch (const std::exception& e) {
+            return Result<void>::fail(e.what());
+        }
+
+        if (size_t pending = ctx.wms.pendingReorderEvents())
+            OutputFormatter::printInfo(std::to_string(pending) + " reorder event(s) pending (reorder drain)");
+
+        if (ctx.autosave) ctx.wms.commit();
         return Result<void>::success();
     }
 };
@@ -57,7 +94,25 @@ public:
 //Command to list the current stock of items
 class ListCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        // Cursor form: list --after <cursor> [pageSize]
+        if (!a.empty() && a[0] == "--after") {
+            if (a.size() < 2 || a.size() > 3)
+                return Result<void>::fail("Usage: list --after <cursor> [pageSize]");
+
+            size_t pageSize = 10;
+            if (a.size() == 3) {
+                auto ps = safetyparse(a[2]);
+                if (!ps.ok) return Result<void>::fail(ps.error);
+                pageSize = static_cast<size_t>(std::max(1, ps.value));
+            }
+
+            const std::string cursor(a[1]);
+            if (!ctx.wms.listItemsAfter(cursor, pageSize, ctx.arena))
+                return Result<void>::fail("Invalid cursor: " + cursor);
+            return Result<void>::success();
+        }
+
         size_t page = 0, pageSize = 10;
         if (a.size() >= 1) {
             auto p = safetyparse(a[0]);
@@ -70,7 +125,7 @@ public:
             pageSize = static_cast<size_t>(std::max(1, ps.value));
         }
 
-        ctx.wms.listItems(page, pageSize);
+        ctx.wms.listItems(page, pageSize, ctx.arena);
         return Result<void>::success();
     }
 };
@@ -78,26 +133,444 @@ public:
 //Command to Search for a specfic item
 class SearchCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
         if (a.size() != 1) return Result<void>::fail("Usage: search <id>");
 
         auto id = safetyparse(a[0]);
         if (!id.ok) return Result<void>::fail(id.error);
 
-        auto item = ctx.wms.getItem(id.value);
-        if (!item.has_value()) return Result<void>::fail("Item not found");
+        const Item* item = ctx.wms.viewItem(id.value);
+        if (!item) return Result<void>::fail("Item not found");
+
+        printItem(*item);
+        return Result<void>::success();
+    }
+};
+
+//Command to look an item up by the SKU/barcode a scanner sends
+class ScanCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.size() != 1) return Result<void>::fail("Usage: scan <sku>");
+
+        const std::string sku(a[0]);
+        const Item* item = ctx.wms.viewBySku(sku);
+        if (!item) return Result<void>::fail("Unknown SKU: " + sku);
+
+        printItem(*item);
+        return Result<void>::success();
+    }
+};
+
+//Command to find items whose name contains a substring
+class FindCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.empty() || a.size() > 2 || (a.size() == 2 && a[1] != "-i"))
+            return Result<void>::fail("Usage: find <text> [-i]");
+
+        auto found = ctx.wms.findByName(std::string(a[0]), a.size() == 2);
+        if (found.empty()) {
+            OutputFormatter::printWarning("No matching items");
+            return Result<void>::success();
+        }
+
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(found.size());
+        for (const Item* item : found) {
+            rows.push_back({
+                std::to_string(item->getId()),
+                item->getName(),
+                std::to_string(item->getQuantity()),
+                item->getLocation()
+            });
+        }
+
+        OutputFormatter::printTable({"ID", "Name", "Quantity", "Location"}, rows);
+        return Result<void>::success();
+    }
+};
+
+//Command to run a filtered/ordered/projected query, or explain its plan
+class QueryCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.empty())
+            return Result<void>::fail("Usage: query <term>... [explain]  (loc= loc^= in= qty=a..b name= iname= cat= fields= order=[-]key limit=)");
+
+        bool explain = false;
+        auto parsed = Query::parse(a, explain);
+        if (!parsed.ok)
+            return Result<void>::fail(parsed.error);
+        const Query& q = parsed.value;
+
+        if (explain) {
+            OutputFormatter::printInfo("Plan: " + ctx.wms.explainQuery(q).describe(q));
+            return Result<void>::success();
+        }
+
+        OutputFormatter::TableRows rows(ctx.arena);
+        ctx.wms.runQuery(q, [&](const Item& item) {
+            QueryEngine::project(q, item, rows.emplace_back());
+            return true;
+        }, ctx.arena);
+
+        if (rows.empty()) {
+            OutputFormatter::printWarning("No matching items");
+            return Result<void>::success();
+        }
+        OutputFormatter::printTable(QueryEngine::headers(q), rows);
+        return Result<void>::success();
+    }
+};
+
+//Command to complete a partial item id or name
+class CompleteCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.empty() || a.size() > 2)
+            return Result<void>::fail("Usage: complete <prefix> [limit]");
+
+        size_t limit = 10;
+        if (a.size() == 2) {
+            auto l = safetyparse(a[1]);
+            if (!l.ok || l.value < 1) return Result<void>::fail("Invalid limit: " + std::string(a[1]));
+            limit = static_cast<size_t>(l.value);
+        }
+
+        const std::string prefix(a[0]);
+        std::vector<std::vector<std::string>> rows;
+        for (int id : ctx.wms.completeIds(prefix, limit)) {
+            const Item* item = ctx.wms.viewItem(id);
+            rows.push_back({std::to_string(id), "id", item ? item->getName() : ""});
+        }
+        if (rows.size() < limit) {
+            for (const auto& name : ctx.wms.completeNames(prefix, limit - rows.size()))
+                rows.push_back({name, "name", ""});
+        }
+
+        if (rows.empty()) {
+            OutputFormatter::printWarning("No completions for '" + prefix + "'");
+            return Result<void>::success();
+        }
+        OutputFormatter::printTable({"Completion", "Kind", "Item"}, rows);
+        return Result<void>::success();
+    }
+};
+
+//Command to list everything in a zone, aisle, rack or bin
+class LocateCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.empty() || a.size() > 2)
+            return Result<void>::fail("Usage: locate <zone[-aisle[-rack[-bin]]]> [limit]");
+
+        auto area = LocationCode::parsePrefix(a[0]);
+        if (!area)
+            return Result<void>::fail("Invalid location prefix: " + std::string(a[0]));
+
+        size_t limit = 50;
+        if (a.size() == 2) {
+            auto l = safetyparse(a[1]);
+            if (!l.ok || l.value < 1) return Result<void>::fail("Invalid limit: " + std::string(a[1]));
+            limit = static_cast<size_t>(l.value);
+        }
+
+        auto found = ctx.wms.itemsUnder(*area);
+        if (found.empty()) {
+            OutputFormatter::printWarning("No items under " + area->toString());
+            return Result<void>::success();
+        }
+
+        // One line summary of the next level down, e.g. "B-07: 03 (40), 04 (83)"
+        std::ostringstream summary;
+        summary << found.size() << " item(s) under " << area->toString();
+        if (area->depth() < LocationCode::LEVELS) {
+            const char* sep = ": ";
+            for (const auto& [segment, count] : ctx.wms.locationBreakdown(*area)) {
+                summary << sep << LocationCode::segmentText(area->depth(), segment) << " (" << count << ")";
+                sep = ", ";
+            }
+        }
+        OutputFormatter::printInfo(summary.str());
+
+        std::vector<std::vector<std::string>> rows;
+        for (size_t i = 0; i < found.size() && i < limit; ++i) {
+            rows.push_back({
+                std::to_string(found[i]->getId()),
+                found[i]->getName(),
+                std::to_string(found[i]->getQuantity()),
+                found[i]->getLocation()
+            });
+        }
+        OutputFormatter::printTable({"ID", "Name", "Quantity", "Location"}, rows);
+        return Result<void>::success();
+    }
+};
+
+//Command for replenishment rankings without sorting the whole catalog
+class TopCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        const char* usage = "Usage: top low|high|value <k> | top below <qty> [limit]";
+        if (a.size() < 2 || a.size() > 3)
+            return Result<void>::fail(usage);
+
+        auto n = safetyparse(a[1]);
+        if (!n.ok)
+            return Result<void>::fail(n.error);
+
+        ItemView found;
+        if (a[0] == "below") {
+            size_t limit = SIZE_MAX;
+            if (a.size() == 3) {
+                auto l = safetyparse(a[2]);
+                if (!l.ok || l.value < 0)
+                    return Result<void>::fail("Invalid limit: " + std::string(a[2]));
+                limit = static_cast<size_t>(l.value);
+            }
+            found = ctx.wms.belowReorderPoint(n.value, limit);
+        } else {
+            if (a.size() != 2 || n.value < 0)
+                return Result<void>::fail(usage);
+            const size_t k = static_cast<size_t>(n.value);
+            if (a[0] == "low") found = ctx.wms.lowestStock(k);
+            else if (a[0] == "high") found = ctx.wms.highestStock(k);
+            else if (a[0] == "value") found = ctx.wms.highestValue(k);
+            else return Result<void>::fail(usage);
+        }
+
+        if (found.empty()) {
+            OutputFormatter::printWarning("No matching items");
+            return Result<void>::success();
+        }
+
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(found.size());
+        for (const Item* item : found) {
+            std::ostringstream value;
+            value << std::fixed << std::setprecision(2) << item->getQuantity() * item->getPrice();
+            rows.push_back({
+                std::to_string(item->getId()),
+                item->getName(),
+                std::to_string(item->getQuantity()),
+                item->getLocation(),
+                value.str()
+            });
+        }
+
+        OutputFormatter::printTable({"ID", "Name", "Quantity", "Location", "Value"}, rows);
+        return Result<void>::success();
+    }
+};
+
+//Command to configure reorder thresholds and drain triggered events
+class ReorderCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        const char* usage = "Usage: reorder set <id> <qty> | reorder category <name> <qty> | reorder clear <id> | reorder drain [max]";
+        if (a.empty())
+            return Result<void>::fail(usage);
+
+        if (a[0] == "set" && a.size() == 3) {
+            auto id = safetyparse(a[1]);
+            auto qty = safetyparse(a[2]);
+            if (!id.ok || !qty.ok)
+                return Result<void>::fail(id.ok ? qty.error : id.error);
+            if (!ctx.wms.setReorderPoint(id.value, qty.value))
+                return Result<void>::fail("Item not found");
+            return Result<void>::success();
+        }
+
+        if (a[0] == "category" && a.size() == 3) {
+            auto qty = safetyparse(a[2]);
+            if (!qty.ok) return Result<void>::fail(qty.error);
+            ctx.wms.setCategoryReorderPoint(std::string(a[1]), qty.value);
+            return Result<void>::success();
+        }
+
+        if (a[0] == "clear" && a.size() == 2) {
+            auto id = safetyparse(a[1]);
+            if (!id.ok) return Result<void>::fail(id.error);
+            ctx.wms.clearReorderPoint(id.value);
+            return Result<void>::success();
+        }
+
+        if (a[0] == "drain" && a.size() <= 2) {
+            size_t max = SIZE_MAX;
+            if (a.size() == 2) {
+                auto m = safetyparse(a[1]);
+                if (!m.ok || m.value < 0) return Result<void>::fail("Invalid max: " + std::string(a[1]));
+                max = static_cast<size_t>(m.value);
+            }
+
+            auto events = ctx.wms.drainReorderEvents(max);
+            if (events.empty()) {
+                OutputFormatter::printInfo("No reorder events");
+                return Result<void>::success();
+            }
+
+            std::vector<std::vector<std::string>> rows;
+            rows.reserve(events.size());
+            for (const auto& e : events) {
+                rows.push_back({
+                    std::to_string(e.timestamp),
+                    std::to_string(e.itemId),
+                    std::to_string(e.quantity),
+                    std::to_string(e.threshold),
+                    e.below ? "below" : "restocked"
+                });
+            }
+            OutputFormatter::printTable({"Time", "Item", "Quantity", "Threshold", "State"}, rows);
+            return Result<void>::success();
+        }
+
+        return Result<void>::fail(usage);
+    }
+};
+
+//Command to show stock totals, overall or grouped by location/category
+class StatsCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        auto money = [](long long cents) {
+            std::ostringstream ss;
+            ss << std::fixed << std::setprecision(2) << static_cast<double>(cents) / 100.0;
+            return ss.str();
+        };
+        auto row = [&](const std::string& group, const StockTotals& t) {
+            return std::vector<std::string>{
+                group, std::to_string(t.items), std::to_string(t.quantity), money(t.valueCents)
+            };
+        };
+
+        std::vector<std::vector<std::string>> rows;
+        if (a.empty()) {
+            rows.push_back(row("all", ctx.wms.stats()));
+        } else if (a.size() == 1 && (a[0] == "location" || a[0] == "category")) {
+            auto groups = (a[0] == "location") ? ctx.wms.statsByLocation() : ctx.wms.statsByCategory();
+            rows.reserve(groups.size());
+            for (const auto& [name, t] : groups) rows.push_back(row(name, t));
+        } else {
+            return Result<void>::fail("Usage: stats [location|category]");
+        }
+
+        if (rows.empty()) {
+            OutputFormatter::printWarning("No items in inventory");
+            return Result<void>::success();
+        }
+        OutputFormatter::printTable({"Group", "Items", "Quantity", "Value"}, rows);
+        return Result<void>::success();
+    }
+};
+
+//Command to write the inventory out as JSON
+class ExportCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.size() != 1) return Result<void>::fail("Usage: export <file.json>");
+
+        const std::string path(a[0]);
+        if (auto err = ctx.wms.exportJSON(path))
+            return Result<void>::fail(err.value().message);
+        OutputFormatter::printInfo("Exported " + std::to_string(ctx.wms.stats().items) + " item(s) to " + path);
+        return Result<void>::success();
+    }
+};
+
+//Command to add items from a JSON export
+class ImportCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (a.size() != 1) return Result<void>::fail("Usage: import <file.json>");
+
+        std::string err;
+        auto added = ctx.wms.importJSON(std::string(a[0]), err);
+        if (!added) {
+            if (ctx.autosave) ctx.wms.saveAll();   // Valid items around the error were still added
+            return Result<void>::fail(err);
+        }
+        OutputFormatter::printInfo("Imported " + std::to_string(*added) + " item(s)");
+
+        if (ctx.autosave) ctx.wms.saveAll();   // Bulk change: checkpoint instead of journaling
+        return Result<void>::success();
+    }
+};
+
+//Command to show how item storage is laid out
+class DiagCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        if (!a.empty()) return Result<void>::fail("Usage: diag");
+
+        const SlabStats s = ctx.wms.storageStats();
+        OutputFormatter::printTable({"Metric", "Value"}, {
+            {"Slab chunks", std::to_string(s.chunks) + " (" + std::to_string(s.emptyChunks) + " empty)"},
+            {"Slots", std::to_string(s.capacity)},
+            {"Live", std::to_string(s.live)},
+            {"Free", std::to_string(s.free)},
+            {"Fragmented", std::to_string(s.fragmented)},
+            {"Reserved bytes", std::to_string(s.bytesReserved)},
+            {"ID index", ctx.wms.denseIdIndex() ? "dense" : "hashed"},
+            {"Interned strings", std::to_string(StringPool::size()) + " (" + std::to_string(StringPool::bytesUsed()) + " bytes)"},
+        });
+        return Result<void>::success();
+    }
+};
+
+//Command to show the audit history of one item, or of the last N seconds
+class AuditCommand : public ICommand {
+public:
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
+        const char* usage = "Usage: audit <id> | audit --since <seconds>";
+        std::vector<AuditRecord> records;
+
+        if (a.size() == 1) {
+            auto id = safetyparse(a[0]);
+            if (!id.ok) return Result<void>::fail(id.error);
+            records = ctx.wms.auditForItem(id.value);
+        } else if (a.size() == 2 && a[0] == "--since") {
+            auto secs = safetyparse(a[1]);
+            if (!secs.ok || secs.value < 0) return Result<void>::fail(usage);
+            records = ctx.wms.auditSince(std::time(nullptr) - secs.value);
+        } else {
+            return Result<void>::fail(usage);
+        }
+
+        if (records.empty()) {
+            OutputFormatter::printWarning("No audit records");
+            return Result<void>::success();
+        }
+
+        auto valueText = [](const AuditRecord& r, int64_t v) {
+            if (static_cast<AuditField>(r.field) == AuditField::Location)
+                return StringPool::str(static_cast<Symbol>(v));
+            return std::to_string(v);
+        };
+
+        std::vector<std::vector<std::string>> rows;
+        rows.reserve(records.size());
+        for (const auto& r : records) {
+            rows.push_back({
+                std::to_string(r.timestamp),
+                std::to_string(r.itemId),
+                static_cast<AuditField>(r.field) == AuditField::Location ? "location" : "quantity",
+                valueText(r, r.oldValue),
+                valueText(r, r.newValue)
+            });
+        }
 
-        printItem(item.value());
+        OutputFormatter::printTable({"Time", "ID", "Field", "Old", "New"}, rows);
         return Result<void>::success();
     }
 };
 
 class QueueCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
         if (a.empty()) return Result<void>::fail("Usage: queue <command...>");
 
-        std::vector<std::string> parts = a;
+        std::vector<std::string> parts(a.begin(), a.end());
         std::transform(parts[0].begin(), parts[0].end(), parts[0].begin(), ::toupper);
 
         std::ostringstream raw;
@@ -113,7 +586,7 @@ public:
 
 class ProcessQueueCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
         size_t limit = 0;
         if (!a.empty()) {
             auto parsed = safetyparse(a[0]);
@@ -123,13 +596,14 @@ public:
         }
 
         ctx.wms.processTasks(limit);
+        if (ctx.autosave) ctx.wms.commit();
         return Result<void>::success();
     }
 };
 
 class ReceiptCommand : public ICommand {
 public:
-    Result<void> execute(CommandContext& ctx, const std::vector<std::string>& a) override {
+    Result<void> execute(CommandContext& ctx, const CommandArgs& a) override {
         if (a.size() < 3)
             return Result<void>::fail("Usage: receipt <id quantity price>... [customer]");
 
@@ -144,7 +618,7 @@ public:
             return Result<void>::fail("Usage: receipt <id quantity price>... [customer]");
         }
 
-        Receipt receipt;
+        Receipt receipt(ctx.arena);
         if (!customer.empty()) receipt.setCustomer(customer);
 
         for (size_t i = 0; i < itemsEnd; i += 3) {
@@ -153,20 +627,20 @@ public:
 
             int qty = 0;
             double price = 0.0;
-            try { qty = std::stoi(a[i + 1]); }
+            try { qty = std::stoi(std::string(a[i + 1])); }
             catch (const std::exception&) { return Result<void>::fail("Quantity must be an integer"); }
 
-            try { price = std::stod(a[i + 2]); }
+            try { price = std::stod(std::string(a[i + 2])); }
             catch (const std::exception&) { return Result<void>::fail("Price must be a number"); }
 
             if (qty <= 0) return Result<void>::fail("Quantity must be > 0");
             if (price < 0) return Result<void>::fail("Price cannot be negative");
 
-            auto item = ctx.wms.getItem(id.value);
-            if (!item.has_value()) return Result<void>::fail("Item not found");
+            const Item* item = ctx.wms.viewItem(id.value);
+            if (!item) return Result<void>::fail("Item not found");
 
             try {
-                receipt.addItem(item.value(), qty, price);
+                receipt.addItem(*item, qty, price);
             } catch (const std::exception& e) {
                 return Result<void>::fail(std::string("Failed to add item: ") + e.what());
             }
@@ -2,15 +2,12 @@
 
 //Included file
 #include "results.hpp"
-
-//Needed libraries
-#include <vector>
-#include <string>
+#include "parser.hpp"   // CommandArgs
 
 struct CommandContext; // Forward declare to avoid circularity if needed
 
 // Interface for commands
 struct ICommand {
     virtual ~ICommand() = default;
-    virtual Result<void> execute(CommandContext&, const std::vector<std::string>&) = 0;
+    virtual Result<void> execute(CommandContext&, const CommandArgs&) = 0;
 };
\ No newline at end of file
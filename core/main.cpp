@@ -23,10 +23,11 @@
 ============================================*/
 
 int processLine(CommandRegistry& reg, CommandContext& ctx, const std::string& line) {
-    auto args = tokenize(line);
+    CommandArena scratch(ctx);         // Holds the tokens and the command's scratch data
+    auto args = tokenize(line, ctx.arena);
     if (args.empty()) return 0;
 
-    std::string cmd = args[0];         // Extract command
+    std::string cmd(args[0]);          // Extract command
     std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
     args.erase(args.begin());          // Remove command name
 
@@ -46,6 +47,46 @@ int processLine(CommandRegistry& reg, CommandContext& ctx, const std::string& li
     return 0;
 }
 
+/*==========================================
+        = Tab completion
+============================================*/
+
+// The console hands us a line only after Enter, so a line ending in a Tab
+// ("search 12<Tab><Enter>") asks to complete its last word instead of
+// running. Candidates come from the inventory's id/name prefix index.
+void completeLine(CommandContext& ctx, const std::string& line) {
+    const std::string head = line.substr(0, line.find_last_not_of('\t') + 1);
+    const size_t cut = head.find_last_of(' ');
+    const std::string word = (cut == std::string::npos) ? head : head.substr(cut + 1);
+    const std::string before = (cut == std::string::npos) ? "" : head.substr(0, cut + 1);
+    if (word.empty()) return;
+
+    const size_t limit = 20;
+    std::vector<std::string> matches;
+    for (int id : ctx.wms.completeIds(word, limit)) matches.push_back(std::to_string(id));
+    for (const auto& name : ctx.wms.completeNames(word, limit - matches.size())) matches.push_back(name);
+
+    if (matches.empty()) {
+        OutputFormatter::printWarning("No completions for '" + word + "'");
+        return;
+    }
+
+    // Extend the word as far as every candidate agrees
+    std::string common = matches[0];
+    for (const auto& m : matches) {
+        auto diff = std::mismatch(common.begin(), common.end(), m.begin(), m.end());
+        common.erase(diff.first, common.end());
+    }
+
+    if (matches.size() > 1) {
+        std::string list;
+        for (const auto& m : matches) list += m + "  ";
+        OutputFormatter::printInfo(list + (matches.size() == limit ? "..." : ""));
+    }
+    if (common.size() > word.size() || matches.size() == 1)
+        OutputFormatter::printInfo("Complete: " + before + common);
+}
+
 /*==========================================
         = Main function 
 ============================================*/
@@ -64,10 +105,25 @@ int main(int argc, char* argv[]) {
     OutputFormatter::printInfo("Type 'help' for commands, 'exit' to quit.");
 
     const std::vector<std::pair<std::string, std::string>> commands = {
-        {"add <id> <name> <quantity> <location>", "                                             Add new item"},
+        {"add <id> <name> <quantity> <location> [sku]", "                                       Add new item"},
         {"remove <id>", "                                                                  Remove item by id"},
+        {"adjust <id> <delta>", "                                     Change an item's stock"},
         {"list [page] [pageSize]", "                                                      List items (paged)"},
+        {"list --after <cursor> [pageSize]", "                         Continue listing from a cursor"},
         {"search <id>", "Find item by id"},
+        {"scan <sku>", "                                                      Find item by SKU/barcode"},
+        {"find <text> [-i]", "                                 Find items by name (-i ignores case)"},
+        {"query <term>... [explain]", "                          Filter/order/project items (see README)"},
+        {"complete <prefix> [limit]", "                         Complete an item id or name (or end a line with Tab)"},
+        {"locate <zone[-aisle[-rack[-bin]]]> [limit]", "      Items in a zone/aisle/rack/bin"},
+        {"top low|high|value <k>", "                               Lowest/highest stock or value"},
+        {"top below <qty> [limit]", "                           Items under a reorder point"},
+        {"reorder set <id> <qty> | category <name> <qty>", "  Set a reorder threshold"},
+        {"reorder clear <id> | reorder drain [max]", "         Clear a threshold / show triggered events"},
+        {"stats [location|category]", "                        Stock totals (overall or grouped)"},
+        {"diag", "                                                     Item storage diagnostics"},
+        {"export <file.json> | import <file.json>", "         JSON export / import"},
+        {"audit <id> | audit --since <seconds>", "                      Show item change history"},
         {"queue <COMMAND...>", "                                       Queue a task (ADD/REMOVE/LIST/SEARCH)"},
         {"runq [limit]", "                                                              Process queued tasks"},
         {"receipt <id quantity price>... [customer]", "           Generate & save a receipt (multiple lines)"},
@@ -76,7 +132,12 @@ int main(int argc, char* argv[]) {
         {"version/-v/--version", "                                                              Show version"},
         {"--help/-h", "                                                                       Show CLI help "},
         {"--no-color", "                                                              Disable colored output"},
-        {"-a/--autosave", "                                                          Save after each command"},
+        {"-a/--autosave", "                                                          Journal each change (periodic snapshots)"},
+        {"--audit-spill=<file>", "                                  Spill full audit chunks to a file"},
+        {"--durability=none|commit|group", "                  fsync policy for saves (default: commit)"},
+        {"--group-window=<us>", "                                 Hold group commits open this long (default: 0)"},
+        {"--snapshot=binary|json", "                          Checkpoint format (default: binary)"},
+        {"--load-threads=<n>", "                                  Threads for loading JSON (default: 0 = one per core)"},
     };
 
     if (opt.showHelp) {
@@ -88,12 +149,69 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    // Audit journal spills to disk only when asked to
+    if (opt.namedArgs.count("audit-spill")) {
+        std::string err;
+        if (!AuditJournal::global().enableSpill(opt.namedArgs["audit-spill"], err)) {
+            OutputFormatter::printError(err);
+            return 1;
+        }
+    }
+
+    // fsync policy; group batches concurrent commits into one fsync
+    Durability durability = Durability::Commit;
+    if (opt.namedArgs.count("durability")) {
+        const std::string& mode = opt.namedArgs["durability"];
+        if (mode == "none") durability = Durability::None;
+        else if (mode == "commit") durability = Durability::Commit;
+        else if (mode == "group") durability = Durability::Group;
+        else {
+            OutputFormatter::printError("Unknown durability mode: '" + mode + "' (none|commit|group)");
+            return 1;
+        }
+    }
+
+    auto groupWindow = MutationJournal::DEFAULT_GROUP_WINDOW;
+    if (opt.namedArgs.count("group-window")) {
+        auto us = safetyparse(opt.namedArgs["group-window"]);
+        if (!us.ok || us.value < 0) {
+            OutputFormatter::printError("Invalid group window: '" + opt.namedArgs["group-window"] + "' (microseconds)");
+            return 1;
+        }
+        groupWindow = std::chrono::microseconds(us.value);
+    }
+
+    SnapshotFormat snapshotFormat = SnapshotFormat::Binary;
+    if (opt.namedArgs.count("snapshot")) {
+        const std::string& format = opt.namedArgs["snapshot"];
+        if (format == "binary") snapshotFormat = SnapshotFormat::Binary;
+        else if (format == "json") snapshotFormat = SnapshotFormat::Json;
+        else {
+            OutputFormatter::printError("Unknown snapshot format: '" + format + "' (binary|json)");
+            return 1;
+        }
+    }
+
+    size_t loadThreads = 0;
+    if (opt.namedArgs.count("load-threads")) {
+        auto n = safetyparse(opt.namedArgs["load-threads"]);
+        if (!n.ok || n.value < 0) {
+            OutputFormatter::printError("Invalid load thread count: '" + opt.namedArgs["load-threads"] + "'");
+            return 1;
+        }
+        loadThreads = static_cast<size_t>(n.value);
+    }
+
     // Initialize system
     WmsControllers wms("inventory_data.json");
+    wms.setDurability(durability, groupWindow);
+    wms.setSnapshotFormat(snapshotFormat);
+    wms.setLoadThreads(loadThreads);
     if (!wms.initializeSystem()) {
         OutputFormatter::printError("Failed to initialize WMS. Exiting.");
         return 1;
     }
+    wms.enableJournal(autosave);
 
     // Register commands
     CommandRegistry registry;
@@ -101,6 +219,19 @@ int main(int argc, char* argv[]) {
     registry.registerCommand<RemoveCommand>("remove");
     registry.registerCommand<ListCommand>("list");
     registry.registerCommand<SearchCommand>("search");
+    registry.registerCommand<FindCommand>("find");
+    registry.registerCommand<ScanCommand>("scan");
+    registry.registerCommand<QueryCommand>("query");
+    registry.registerCommand<TopCommand>("top");
+    registry.registerCommand<LocateCommand>("locate");
+    registry.registerCommand<CompleteCommand>("complete");
+    registry.registerCommand<AdjustCommand>("adjust");
+    registry.registerCommand<ReorderCommand>("reorder");
+    registry.registerCommand<StatsCommand>("stats");
+    registry.registerCommand<DiagCommand>("diag");
+    registry.registerCommand<ExportCommand>("export");
+    registry.registerCommand<ImportCommand>("import");
+    registry.registerCommand<AuditCommand>("audit");
     registry.registerCommand<QueueCommand>("queue");
     registry.registerCommand<ProcessQueueCommand>("runq");
     registry.registerCommand<ReceiptCommand>("receipt");
@@ -127,7 +258,9 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
-        auto result = command->execute(ctx, opt.positionalArgs);
+        CommandArena scratch(ctx);
+        CommandArgs args(opt.positionalArgs.begin(), opt.positionalArgs.end(), ctx.arena);
+        auto result = command->execute(ctx, args);
         if (!result.ok) {
             OutputFormatter::printError("Error: " + result.error);
             return 1;
@@ -146,6 +279,11 @@ int main(int argc, char* argv[]) {
         input.erase(0, input.find_first_not_of(" \t"));  // Trim leading whitespace
         if (input.empty()) continue;
 
+        if (input.back() == '\t') {
+            completeLine(ctx, input);
+            continue;
+        }
+
         if (input == "exit") {
             // VISUAL: ASCII-only output.
             OutputFormatter::printInfo("Goodbye!");
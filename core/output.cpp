@@ -60,7 +60,7 @@ bool OutputFormatter::isColorEnabled() {
     return useColor;
 }
 
-void OutputFormatter::write(const std::string& t) {
+void OutputFormatter::write(std::string_view t) {
     std::cout<<t;
     if(logEnabled && logFile.is_open()) logFile<<t;
 }
@@ -132,47 +132,65 @@ std::string OutputFormatter::wrap(const std::string& txt,size_t w){
 
 void OutputFormatter::printTable(const std::vector<std::string>& h,
 const std::vector<std::vector<std::string>>& r,size_t page){
+    printRows(h, r, page);
+}
+
+void OutputFormatter::printTable(const std::vector<std::string>& h,
+const TableRows& r,size_t page){
+    printRows(h, r, page);
+}
+
+// Cells are written straight from the row strings (truncated views plus
+// padding), so printing a table allocates only the divider line.
+template<typename Rows>
+void OutputFormatter::printRows(const std::vector<std::string>& h, const Rows& r, size_t page){
     if (h.empty()) return;
 
     const size_t cols = h.size();
     const size_t termW = (terminalWidth() > 4) ? (terminalWidth() - 4) : 80;
     const size_t colW = std::max<size_t>(8, termW / cols);
 
-    auto fit = [&](const std::string& s) {
-        if (s.size() <= colW) return s;
-        if (colW <= 3) return s.substr(0, colW);
-        return s.substr(0, colW - 3) + "...";
-    };
+    std::string divider = "+";
+    for (size_t i = 0; i < cols; i++) {
+        divider.append(colW + 2, '-');
+        divider += '+';
+    }
+    divider += '\n';
 
-    auto printDivider = [&]() {
-        write("+");
-        for (size_t i = 0; i < cols; i++) {
-            write(std::string(colW + 2, '-') + "+");
-        }
-        write("\n");
+    auto pad = [&](size_t n) {
+        static constexpr std::string_view spaces = "                                ";
+        for (; n > spaces.size(); n -= spaces.size()) write(spaces);
+        write(spaces.substr(0, n));
     };
 
-    auto printRow = [&](const std::vector<std::string>& row, bool isHeader) {
+    auto printRow = [&](const auto& row, bool isHeader) {
         write("|");
         for (size_t i = 0; i < cols; i++) {
-            const std::string cell = (i < row.size()) ? fit(row[i]) : std::string();
+            std::string_view cell = (i < row.size()) ? std::string_view(row[i]) : std::string_view();
+            const bool cut = cell.size() > colW;
+            if (cut) cell = cell.substr(0, colW <= 3 ? colW : colW - 3);
+
             if (isHeader) setColor(FOREGROUND_BLUE | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-            write(" " + cell + std::string(colW - cell.size(), ' ') + " |");
+            write(" ");
+            write(cell);
+            if (cut && colW > 3) write("...");
+            else pad(colW - cell.size());
+            write(" |");
             if (isHeader) resetColor();
         }
         write("\n");
     };
 
     for (size_t p = 0; p < r.size(); p += page) {
-        printDivider();
+        write(divider);
         printRow(h, true);
-        printDivider();
+        write(divider);
 
         for (size_t i = p; i < std::min(p + page, r.size()); i++) {
             printRow(r[i], false);
         }
 
-        printDivider();
+        write(divider);
 
         if (p + page < r.size()) {
             write("-- More -- press Enter to continue --");
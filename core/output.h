@@ -1,10 +1,16 @@
 #pragma once
+#include <memory_resource>
+#include <string_view>
 #include <string>
 #include <vector>
 #include <fstream>
 
 class OutputFormatter {
 public:
+    // Table rows built in a command's arena (see CommandArena)
+    using TableRow = std::pmr::vector<std::pmr::string>;
+    using TableRows = std::pmr::vector<TableRow>;
+
     static void initialize(bool enableColor = true, bool enableLogging = false, const std::string& logFile = "wms.log");
 
     // VISUAL: keep startup output ASCII-only to avoid mojibake in Windows terminals.
@@ -20,6 +26,9 @@ public:
     static void printTable(const std::vector<std::string>& headers,
                            const std::vector<std::vector<std::string>>& rows,
                            size_t pageSize = 15);
+    static void printTable(const std::vector<std::string>& headers,
+                           const TableRows& rows,
+                           size_t pageSize = 15);
 
     static void printLogo(const std::string& path = "");
     static void printVersion(const std::string& version);
@@ -33,7 +42,10 @@ private:
     static size_t terminalWidth();
     static std::string wrap(const std::string& text, size_t width);
 
-    static void write(const std::string& txt);
+    static void write(std::string_view txt);
+
+    template<typename Rows>
+    static void printRows(const std::vector<std::string>& headers, const Rows& rows, size_t pageSize);
 
     static bool useColor;
     static bool logEnabled;
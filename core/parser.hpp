@@ -1,19 +1,26 @@
 #pragma once
+#include <memory_resource>
 #include <vector>
 #include <string>
+#include <utility>
 
-// Simple tokenizer for command line input
-inline std::vector<std::string> tokenize(const std::string& line) {
-    std::vector<std::string> args;
-    std::string cur;
+// A tokenized command line; tokens live in the command's arena
+using CommandArgs = std::pmr::vector<std::pmr::string>;
+
+// Simple tokenizer for command line input. The vector and its tokens are
+// allocated from `arena` (main() passes the running command's CommandArena).
+inline CommandArgs tokenize(const std::string& line,
+                            std::pmr::memory_resource* arena = std::pmr::get_default_resource()) {
+    CommandArgs args(arena);
+    std::pmr::string cur(arena);
     bool inQuotes = false;
 
     for (char c : line) {
         if (c == '"') inQuotes = !inQuotes;
         else if (c == ' ' && !inQuotes) {
-            if (!cur.empty()) { args.push_back(cur); cur.clear(); }
+            if (!cur.empty()) { args.push_back(std::move(cur)); cur.clear(); }
         } else cur += c;
     }
-    if (!cur.empty()) args.push_back(cur);
+    if (!cur.empty()) args.push_back(std::move(cur));
     return args;
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 #include "results.hpp"
 #include <string>
+#include <string_view>
 
 // Safely parse integer from string
-inline Result<int> safetyparse(const std::string& s) {
+inline Result<int> safetyparse(std::string_view text) {
+    const std::string s(text);
     try {
         size_t i;
         int v = std::stoi(s, &i);
@@ -0,0 +1,21 @@
+#pragma once
+
+//Needed libraries
+#include <cstdio>
+
+// Shared pass/fail reporting for the programs in tests/ (see README).
+// Each check prints one line; main() ends with `return test::finish("name");`
+// so the process exits non-zero if any check failed.
+namespace test {
+    inline int failures = 0;
+
+    inline void check(bool ok, const char *what) {
+        std::printf("%s  %s\n", ok ? "PASS" : "FAIL", what);
+        if (!ok) ++failures;
+    }
+
+    inline int finish(const char *name) {
+        std::printf("%s: %s\n", name, failures ? "FAILED" : "all passed");
+        return failures ? 1 : 0;
+    }
+}
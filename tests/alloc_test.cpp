@@ -0,0 +1,162 @@
+//Included files
+#include "Inventory.h"
+#include "JsonItemReader.h"
+#include "TestUtil.h"
+
+//Needed libraries
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Checks that the sink/emplace insert paths move an item's owned strings
+// (name, SKU) into storage instead of copying them. Two independent
+// signals: the stored string still owns the buffer that was passed in,
+// and a move-insert makes exactly two fewer allocations than a copy of
+// the same item (every other allocation is index upkeep shared by both).
+// A JSON load is counted the same way: one allocation per string field.
+//   g++ -std=c++17 -O2 -pthread -Icore tests/alloc_test.cpp $(ls core/*.cpp | grep -v main.cpp) -o alloc_test && ./alloc_test
+
+// ─────────────────────────────────────────────
+// Allocation counter
+// ─────────────────────────────────────────────
+static std::atomic<size_t> allocations{0};
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+template<typename Work>
+static size_t countAllocations(Work &&work) {
+    const size_t before = allocations.load();
+    work();
+    return allocations.load() - before;
+}
+
+// ─────────────────────────────────────────────
+// Test items
+// ─────────────────────────────────────────────
+// Long enough to defeat the small-string buffer, so each copy allocates
+static std::string longName(int id) { return "Heavy duty hex bolt, zinc plated, #" + std::to_string(id); }
+static std::string longSku(int id) { return "SKU-0000000000000000-" + std::to_string(id); }
+
+static Item makeItem(int id) {
+    return Item(id, longName(id), 5, "A-01-01-01", 1.25, "EGP", "pcs", "general", longSku(id));
+}
+
+// A small inventory file of the same items (no escapes, so the reader
+// hands out views into the document and allocates nothing itself)
+static std::string jsonDocument(int firstId, int count) {
+    std::string doc = "[";
+    for (int id = firstId; id < firstId + count; ++id) {
+        if (id > firstId) doc += ",";
+        doc += "{\"id\": " + std::to_string(id) + ", \"name\": \"" + longName(id) + "\", \"quantity\": 5, "
+               "\"location\": \"A-01-01-01\", \"price\": 1.25, \"sku\": \"" + longSku(id) + "\"}";
+    }
+    return doc + "]";
+}
+
+int main() {
+    Inventory inv("alloc_test.json");
+    inv.reserve(64);
+    inv.addItem(makeItem(1));   // Interns the shared fields and warms the indexes
+
+    // addItem(Item&&): the stored strings are the ones handed in
+    {
+        Item item = makeItem(2);
+        const char *name = item.getName().data();
+        const char *sku = item.getSku().data();
+        inv.addItem(std::move(item));
+        const Item *stored = inv.findItem(2);
+        test::check(stored && stored->getName().data() == name && stored->getSku().data() == sku,
+                    "addItem(Item&&) keeps the caller's name and SKU buffers");
+    }
+
+    // The same insert into two inventories in the same state, copied vs
+    // moved: the copy pays for name + SKU, index upkeep is identical
+    {
+        Inventory a("alloc_a.json"), b("alloc_b.json");
+        for (Inventory *side : {&a, &b}) {
+            side->reserve(64);
+            for (int id = 1; id <= 8; ++id) side->addItem(makeItem(id));
+        }
+        Item copied = makeItem(9);
+        Item moved = makeItem(9);
+        const size_t copyCost = countAllocations([&] { a.addItem(copied); });
+        const size_t moveCost = countAllocations([&] { b.addItem(std::move(moved)); });
+        std::printf("      addItem: copy %zu allocations, move %zu\n", copyCost, moveCost);
+        test::check(copyCost == moveCost + 2, "addItem(Item&&) allocates exactly two fewer than a copy");
+    }
+
+    // emplaceItem: string arguments passed as rvalues end up in storage
+    {
+        std::string name = longName(5);
+        std::string sku = longSku(5);
+        const char *nameBuf = name.data();
+        const char *skuBuf = sku.data();
+        inv.emplaceItem(5, std::move(name), 7, "A-01-01-02", 2.5, "EGP", "pcs", "general", std::move(sku));
+        const Item *stored = inv.findItem(5);
+        test::check(stored && stored->getName().data() == nameBuf && stored->getSku().data() == skuBuf,
+                    "emplaceItem(std::string&&...) keeps the caller's buffers");
+    }
+
+    // addMultiple(vector&&): every item's strings move in
+    {
+        std::vector<Item> batch;
+        std::vector<std::pair<const char*, const char*>> buffers;
+        for (int id = 10; id < 20; ++id) batch.push_back(makeItem(id));
+        for (const Item &item : batch) buffers.emplace_back(item.getName().data(), item.getSku().data());
+
+        inv.addMultiple(std::move(batch));
+        bool same = true;
+        for (int id = 10; id < 20; ++id) {
+            const Item *stored = inv.findItem(id);
+            same = same && stored && stored->getName().data() == buffers[id - 10].first
+                        && stored->getSku().data() == buffers[id - 10].second;
+        }
+        test::check(same, "addMultiple(std::vector<Item>&&) keeps every item's buffers");
+    }
+
+    // JSON load: ItemFields::toItem allocates once for the name and once
+    // for the SKU, and fromJSON adds nothing on top of moving those Items
+    // into a bulk load
+    {
+        constexpr int count = 16;
+        const std::string doc = jsonDocument(100, count);
+
+        std::vector<Item> built;
+        built.reserve(count);
+        JsonItemReader reader(doc);
+        ItemFields fields;
+        const size_t buildCost = countAllocations([&] {
+            while (reader.next(fields)) built.push_back(fields.toItem());
+        });
+        std::printf("      toItem: %zu allocations for %zu items\n", buildCost, built.size());
+        test::check(!reader.failed() && built.size() == count && buildCost == 2 * count,
+                    "ItemFields::toItem makes one allocation each for name and SKU");
+
+        Inventory manual("alloc_test.json"), loaded("alloc_test.json");
+        manual.reserve(count);
+        loaded.reserve(count);
+        manual.addItem(makeItem(1));   // Same warm state as above for both
+        loaded.addItem(makeItem(1));
+        const size_t insertCost = countAllocations([&] {
+            manual.beginBulkLoad(0);
+            for (Item &item : built) manual.addItem(std::move(item));
+            manual.endBulkLoad();
+        });
+        const size_t loadCost = countAllocations([&] { loaded.fromJSON(doc); });
+        std::printf("      fromJSON: %zu allocations, toItem + bulk insert %zu\n", loadCost, buildCost + insertCost);
+        test::check(loaded.totalItems() == count + 1 && loadCost == buildCost + insertCost,
+                    "fromJSON copies no strings beyond toItem");
+    }
+
+    return test::finish("alloc_test");
+}
@@ -0,0 +1,42 @@
+//Included files
+#include "Inventory.h"
+#include "TestUtil.h"
+
+//Needed libraries
+#include <string>
+
+// Item handles through the Inventory API: they follow an item across
+// other items' removal and the store's rehashes/mode switches, and go
+// null (rather than dangle) once their own item is removed, even when
+// its slab cell is reused.
+//   g++ -std=c++17 -O2 -pthread -Icore tests/handle_test.cpp $(ls core/*.cpp | grep -v main.cpp) -o handle_test && ./handle_test
+
+static void add(Inventory &inv, int id) {
+    inv.emplaceItem(id, "Item " + std::to_string(id), id % 50, "A-01-01-01");
+}
+
+int main() {
+    Inventory inv("handle_test.json");
+    for (int id = 1; id <= 100; ++id) add(inv, id);
+
+    const ItemHandle h = inv.handleOf(42);
+    const Item *before = inv.resolve(h);
+    test::check(h.valid() && before && before->getId() == 42, "handleOf/resolve find a live item");
+    test::check(!inv.handleOf(1000).valid() && inv.resolve(inv.handleOf(1000)) == nullptr, "unknown ID gives an invalid handle");
+
+    // Other items leave and arrive; a far-off ID switches the store to sparse mode
+    for (int id = 1; id <= 100; id += 3) inv.removeItem(id);
+    for (int id = 200; id < 2000; ++id) add(inv, id);
+    add(inv, 50000000);
+    test::check(!inv.denseIdIndex(), "store switched to sparse mode");
+    test::check(inv.resolve(h) == before && inv.findItem(42) == before, "handle survives churn and a mode switch");
+
+    inv.removeItem(42);
+    test::check(inv.resolve(h) == nullptr, "handle to a removed item resolves to nullptr");
+
+    add(inv, 42);   // Likely reuses the freed cell
+    test::check(inv.resolve(h) == nullptr, "stale handle stays null after the ID is re-added");
+    test::check(inv.resolve(inv.handleOf(42)) == inv.findItem(42), "new handle resolves to the new item");
+
+    return test::finish("handle_test");
+}